@@ -16,8 +16,12 @@
 
 #include <array>         // for array
 #include <cstddef>       // for size_t
-#include <gsl/algorithm> // for copy
+#include <cstdint>       // for int8_t, int16_t, int32_t, uint8_t, uint16_t, uint64_t
+#include <gsl/algorithm> // for copy, fill, equal, compare, find, gather, ...
 #include <gsl/span>      // for span
+#include <string>        // for string
+#include <utility>       // for make_pair
+#include <vector>        // for vector
 #include <gtest/gtest.h>
 
 #include "deathTestCommon.h"
@@ -179,6 +183,304 @@ TEST(algorithm_tests, compatible_type)
     }
 }
 
+TEST(algorithm_tests, static_extent_copy)
+{
+    // bytewise
+    {
+        std::array<unsigned char, 32> key{};
+        for (std::size_t i = 0; i < key.size(); ++i) key[i] = static_cast<unsigned char>(i);
+        std::array<unsigned char, 40> dst{};
+
+        copy(span<const unsigned char, 32>(key), span<unsigned char>(dst).subspan(4));
+        EXPECT_EQ(dst[3], 0);
+        EXPECT_EQ(dst[4], 0);
+        EXPECT_EQ(dst[35], 31);
+        EXPECT_EQ(dst[36], 0);
+    }
+
+    // bytewise within one buffer
+    {
+        int a[5] = {1, 2, 3, 4, 5};
+        copy(span<int, 4>(a, 4), span<int>(a + 1, 4));
+        EXPECT_EQ(a[0], 1);
+        EXPECT_EQ(a[1], 1);
+        EXPECT_EQ(a[2], 2);
+        EXPECT_EQ(a[4], 4);
+
+        copy(span<int, 4>(a + 1, 4), span<int>(a, 4));
+        EXPECT_EQ(a[0], 1);
+        EXPECT_EQ(a[1], 2);
+        EXPECT_EQ(a[3], 4);
+    }
+
+    // unrolled
+    {
+        const std::array<std::string, 3> src{"a", "bb", "ccc"};
+        std::array<std::string, 3> dst{};
+
+        copy(span<const std::string, 3>(src), span<std::string, 3>(dst));
+        EXPECT_EQ(dst, src);
+    }
+
+    // too long to unroll
+    {
+        std::array<std::string, details::unroll_limit + 1> src{};
+        src.back() = "last";
+        std::array<std::string, details::unroll_limit + 1> dst{};
+
+        copy(span<std::string, details::unroll_limit + 1>(src), span<std::string>(dst));
+        EXPECT_EQ(dst.back(), "last");
+    }
+}
+
+TEST(algorithm_tests, fill)
+{
+    std::array<byte, 16> block{};
+    gsl::fill(span<byte, 16>(block), static_cast<byte>(0xab));
+    for (const byte b : block) EXPECT_EQ(to_integer<int>(b), 0xab);
+
+    std::array<long, 8> words{};
+    gsl::fill(span<long>(words).subspan(2, 3), 7);
+    EXPECT_EQ(words, (std::array<long, 8>{0, 0, 7, 7, 7, 0, 0, 0}));
+
+    std::array<std::string, 4> names{};
+    gsl::fill(span<std::string, 4>(names), "n/a");
+    EXPECT_EQ(names[3], "n/a");
+
+    std::array<double, 40> samples{};
+    gsl::fill(span<double, 40>(samples), 0.5);
+    EXPECT_EQ(samples[39], 0.5);
+}
+
+TEST(algorithm_tests, equal)
+{
+    std::array<std::uint64_t, 4> hash1{1, 2, 3, 4};
+    std::array<std::uint64_t, 4> hash2{1, 2, 3, 4};
+    const span<const std::uint64_t, 4> a(hash1);
+    const span<const std::uint64_t, 4> b(hash2);
+
+    EXPECT_TRUE(gsl::equal(a, b));
+    EXPECT_TRUE(gsl::equal(a, span<std::uint64_t>(hash2)));
+    EXPECT_FALSE(gsl::equal(a, b.first<3>()));
+    EXPECT_FALSE(gsl::equal(span<const std::uint64_t>(hash1), b.first(3)));
+    hash2[3] = 5;
+    EXPECT_FALSE(gsl::equal(a, b));
+    EXPECT_TRUE(gsl::equal(span<int, 0>(), span<const int>()));
+
+    // not compared bytewise: -0.0 == 0.0
+    const std::array<double, 2> zeros{0.0, -0.0};
+    const std::array<double, 2> more_zeros{-0.0, 0.0};
+    EXPECT_TRUE(gsl::equal(span<const double, 2>(zeros), span<const double, 2>(more_zeros)));
+
+    const std::array<std::string, 2> words{"x", "y"};
+    const std::array<std::string, 2> other_words{"x", "z"};
+    EXPECT_FALSE(
+        gsl::equal(span<const std::string, 2>(words), span<const std::string, 2>(other_words)));
+    EXPECT_TRUE(gsl::equal(span<const std::string>(words), span<const std::string, 2>(words)));
+}
+
+TEST(algorithm_tests, compare)
+{
+    const std::array<unsigned char, 4> low{1, 2, 3, 4};
+    const std::array<unsigned char, 4> high{1, 2, 200, 0};
+
+    EXPECT_LT(compare(span<const unsigned char, 4>(low), span<const unsigned char, 4>(high)), 0);
+    EXPECT_GT(compare(span<const unsigned char, 4>(high), span<const unsigned char, 4>(low)), 0);
+    EXPECT_EQ(compare(span<const unsigned char, 4>(low), span<const unsigned char, 4>(low)), 0);
+
+    // a prefix orders first
+    EXPECT_LT(compare(span<const unsigned char>(low).first(2), span<const unsigned char>(low)), 0);
+    EXPECT_GT(compare(span<const unsigned char, 4>(low), span<const unsigned char, 2>(high.data(), 2)),
+              0);
+
+    // signed elements are not compared bytewise
+    const std::array<signed char, 2> negative{-1, 0};
+    const std::array<signed char, 2> positive{1, 0};
+    EXPECT_LT(compare(span<const signed char, 2>(negative), span<const signed char, 2>(positive)),
+              0);
+
+    const std::array<std::string, 2> words{"b", "a"};
+    const std::array<std::string, 2> other_words{"b", "c"};
+    EXPECT_LT(
+        compare(span<const std::string, 2>(words), span<const std::string, 2>(other_words)), 0);
+    EXPECT_GT(compare(span<const std::string>(other_words), span<const std::string>(words)), 0);
+}
+
+TEST(algorithm_tests, mismatch)
+{
+    std::array<std::uint16_t, 200> a{};
+    std::array<std::uint16_t, 200> b{};
+    EXPECT_EQ(mismatch(span<std::uint16_t>(a), span<std::uint16_t>(b)), 200u);
+
+    b[131] = 1;
+    EXPECT_EQ(mismatch(span<std::uint16_t>(a), span<std::uint16_t>(b)), 131u);
+    EXPECT_EQ(mismatch(span<std::uint16_t>(a).first(100), span<std::uint16_t>(b)), 100u);
+    b[0] = 1;
+    EXPECT_EQ(mismatch(span<std::uint16_t, 200>(a), span<std::uint16_t, 200>(b)), 0u);
+    EXPECT_EQ(mismatch(span<std::uint16_t>(), span<std::uint16_t>(b)), 0u);
+
+    const std::array<std::string, 3> words{"a", "b", "c"};
+    const std::array<std::string, 3> other_words{"a", "b", "d"};
+    EXPECT_EQ(mismatch(span<const std::string>(words), span<const std::string>(other_words)), 2u);
+}
+
+TEST(algorithm_tests, find_and_contains)
+{
+    // long enough for whole blocks and a remainder
+    std::array<std::uint8_t, 1000> bytes{};
+    const span<const std::uint8_t> b{bytes};
+    EXPECT_EQ(find(b, 1), b.size());
+    EXPECT_FALSE(contains(b, 1));
+    bytes[700] = 1;
+    bytes[900] = 1;
+    EXPECT_EQ(find(b, 1), 700u);
+    EXPECT_EQ(find(b, 1000), b.size());
+    bytes[999] = 2;
+    EXPECT_EQ(find(b, 2), 999u);
+    EXPECT_TRUE(contains(span<const std::uint8_t, 1000>(bytes), 2));
+    EXPECT_EQ(find(span<const std::uint8_t>(), 0), 0u);
+
+    const std::array<float, 100> floats{1.0f, 2.0f, -0.0f};
+    EXPECT_EQ(find(span<const float>(floats), 0.0f), 2u);
+    EXPECT_EQ(find(span<const float>(floats), 2.5f), floats.size());
+
+    const std::array<std::string, 3> words{"a", "b", "c"};
+    EXPECT_EQ(find(span<const std::string>(words), "c"), 2u);
+    EXPECT_FALSE(contains(span<const std::string>(words), "d"));
+}
+
+TEST(algorithm_tests, count)
+{
+    std::array<std::uint8_t, 1000> bytes{};
+    EXPECT_EQ(count(span<std::uint8_t>(bytes), 0), 1000u);
+    for (std::size_t i = 0; i < bytes.size(); i += 3) bytes[i] = 5;
+    EXPECT_EQ(count(span<std::uint8_t>(bytes), 5), 334u);
+    EXPECT_EQ(count(span<std::uint8_t, 1000>(bytes), 0), 666u);
+
+    const std::array<std::uint64_t, 5> wide{1, 2, 1, 1, 3};
+    EXPECT_EQ(count(span<const std::uint64_t>(wide), 1u), 3u);
+
+    const std::array<std::string, 3> words{"a", "b", "a"};
+    EXPECT_EQ(count(span<const std::string>(words), "a"), 2u);
+}
+
+TEST(algorithm_tests, min_max)
+{
+    std::array<int, 300> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<int>(i % 50) - 10;
+    const span<const int> v{values};
+    EXPECT_EQ(min_element(v), 0u);
+    EXPECT_EQ(max_element(v), 49u);
+    EXPECT_EQ(minmax(v), std::make_pair(-10, 39));
+
+    values[280] = -11;
+    values[290] = 40;
+    EXPECT_EQ(min_element(v), 280u);
+    EXPECT_EQ(max_element(v), 290u);
+    EXPECT_EQ(minmax(span<const int, 300>(values)), std::make_pair(-11, 40));
+    EXPECT_EQ(min_element(span<const int>()), 0u);
+    EXPECT_EQ(max_element(span<const int>()), 0u);
+
+    const std::array<double, 4> doubles{2.5, -1.0, 7.0, -1.0};
+    EXPECT_EQ(min_element(span<const double>(doubles)), 1u);
+    EXPECT_EQ(max_element(span<const double>(doubles)), 2u);
+    EXPECT_EQ(minmax(span<const double>(doubles)), std::make_pair(-1.0, 7.0));
+
+    const std::array<std::string, 3> words{"b", "a", "c"};
+    EXPECT_EQ(min_element(span<const std::string>(words)), 1u);
+    EXPECT_EQ(minmax(span<const std::string>(words)).second, "c");
+}
+
+TEST(algorithm_tests, replace)
+{
+    std::array<std::int16_t, 200> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<std::int16_t>(i % 4);
+    replace(span<std::int16_t>(values), 3, -1);
+    EXPECT_EQ(count(span<std::int16_t>(values), 3), 0u);
+    EXPECT_EQ(count(span<std::int16_t>(values), -1), 50u);
+    EXPECT_EQ(values[199], -1);
+    EXPECT_EQ(values[198], 2);
+
+    std::array<std::string, 3> words{"a", "b", "a"};
+    replace(span<std::string, 3>(words), "a", "z");
+    EXPECT_EQ(words[0], "z");
+    EXPECT_EQ(words[1], "b");
+    EXPECT_EQ(words[2], "z");
+
+    std::array<float, 70> samples{};
+    for (std::size_t i = 0; i < samples.size(); ++i) samples[i] = i % 2 == 0 ? 0.5f : 1.0f;
+    replace(span<float>(samples), 0.5f, 2.0f);
+    EXPECT_EQ(count(span<float>(samples), 0.5f), 0u);
+    EXPECT_EQ(count(span<float>(samples), 2.0f), 35u);
+    EXPECT_EQ(count(span<float>(samples), 1.0f), 35u);
+}
+
+TEST(algorithm_tests, any_of_and_all_of)
+{
+    std::array<std::int32_t, 150> values{};
+    for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<std::int32_t>(i);
+    const span<const std::int32_t> v{values};
+    const auto negative = [](std::int32_t x) { return x < 0; };
+    const auto small = [](std::int32_t x) { return x < 150; };
+
+    EXPECT_FALSE(any_of(v, negative));
+    EXPECT_TRUE(all_of(v, small));
+    values[149] = -1;
+    EXPECT_TRUE(any_of(v, negative));
+    EXPECT_TRUE(all_of(v, small));
+    values[3] = 150;
+    EXPECT_FALSE(all_of(v, small));
+
+    EXPECT_FALSE(any_of(span<const std::int32_t>(), negative));
+    EXPECT_TRUE(all_of(span<const std::int32_t>(), negative));
+
+    const std::array<std::string, 2> words{"a", "bb"};
+    EXPECT_TRUE(
+        all_of(span<const std::string>(words), [](const std::string& w) { return !w.empty(); }));
+}
+
+TEST(algorithm_tests, gather_and_scatter)
+{
+    // dictionary decode
+    const std::array<std::string, 3> dict{"red", "green", "blue"};
+    const std::array<std::uint8_t, 5> codes{2, 0, 0, 1, 2};
+    std::array<std::string, 5> decoded{};
+    gather(span<const std::string>(dict), span<const std::uint8_t>(codes),
+           span<std::string>(decoded));
+    EXPECT_EQ(decoded[0], "blue");
+    EXPECT_EQ(decoded[3], "green");
+    EXPECT_EQ(decoded[4], "blue");
+
+    std::array<int, 300> values{};
+    std::array<std::int32_t, 300> permutation{};
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<int>(i);
+        permutation[i] = static_cast<std::int32_t>(values.size() - 1 - i);
+    }
+    std::array<int, 300> reversed{};
+    gather(span<const int, 300>(values), span<const std::int32_t>(permutation),
+           span<int>(reversed));
+    EXPECT_EQ(reversed[0], 299);
+    EXPECT_EQ(reversed[299], 0);
+
+    std::array<int, 300> restored{};
+    scatter(span<const int>(reversed), span<const std::int32_t>(permutation),
+            span<int>(restored));
+    EXPECT_TRUE(equal(span<const int>(restored), span<const int>(values)));
+
+    // the last of repeated indices wins
+    const std::array<int, 3> updates{1, 2, 3};
+    const std::array<std::size_t, 3> targets{4, 0, 4};
+    std::array<int, 5> table{};
+    scatter(span<const int>(updates), span<const std::size_t>(targets), span<int>(table));
+    EXPECT_EQ(table[0], 2);
+    EXPECT_EQ(table[4], 3);
+
+    // no indices, nothing to check
+    gather(span<const int>(), span<const int>(), span<int>());
+}
+
 #ifdef CONFIRM_COMPILATION_ERRORS
 TEST(algorithm_tests, incompatible_type)
 {
@@ -222,3 +524,54 @@ TEST(algorithm_tests, small_destination_span)
     copy(src_span_static, dst_span_static);
 #endif
 }
+
+TEST(algorithm_tests, minmax_of_empty_span)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. minmax_of_empty_span";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    EXPECT_DEATH(minmax(span<const int>()), expected);
+}
+
+TEST(algorithm_tests, gather_and_scatter_out_of_range)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. gather_and_scatter_out_of_range";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const std::array<int, 4> src{1, 2, 3, 4};
+    std::array<int, 100> dest{};
+    std::array<std::int16_t, 100> indices{};
+    const span<const int> s{src};
+    const span<const std::int16_t> i{indices};
+    const span<int> d{dest};
+
+    indices[90] = 4;
+    EXPECT_DEATH(gather(s, i, d), expected);
+    indices[90] = -1;
+    EXPECT_DEATH(gather(s, i, d), expected);
+    indices[90] = 3;
+    gather(s, i, d);
+    EXPECT_EQ(dest[90], 4);
+    EXPECT_DEATH(gather(s, i, d.first(99)), expected);
+
+    indices[50] = 100;
+    EXPECT_DEATH(scatter(span<const int>(dest), i, d), expected);
+    EXPECT_DEATH(scatter(s, i, d), expected);
+
+    // negative indices are rejected even where their unsigned value is in range
+    const std::vector<int> large(300, 1);
+    std::vector<int> large_dest(300);
+    const std::int8_t narrow_indices[] = {0, -1, 2};
+    EXPECT_DEATH(gather(span<const int>(large), span<const std::int8_t>(narrow_indices),
+                        span<int>(large_dest)),
+                 expected);
+    EXPECT_DEATH(scatter(span<const int>(large).first(3), span<const std::int8_t>(narrow_indices),
+                         span<int>(large_dest)),
+                 expected);
+}
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/aligned_allocator> // for aligned_allocator, huge_page_allocator
+#include <gsl/aligned_span>      // for aligned_span
+#include <gsl/dyn_array>         // for dyn_array
+#include <gsl/span>              // for span
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t, uint32_t, uintptr_t
+#include <memory>      // for allocator_traits
+#include <new>         // for bad_array_new_length
+#include <type_traits> // for is_same
+#include <utility>     // for move
+#include <vector>      // for vector
+
+using namespace gsl;
+
+namespace
+{
+template <std::size_t Alignment, class T>
+bool is_aligned_to(const T* ptr)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % Alignment == 0;
+}
+
+constexpr std::size_t huge_page = std::size_t{2} << 20;
+} // namespace
+
+static_assert(std::is_same<std::allocator_traits<aligned_allocator<int, 128>>::rebind_alloc<char>,
+                           aligned_allocator<char, 128>>::value,
+              "aligned_allocator should rebind to the same alignment");
+static_assert(std::is_same<std::allocator_traits<huge_page_allocator<int>>::rebind_alloc<char>,
+                           huge_page_allocator<char>>::value,
+              "huge_page_allocator should rebind");
+
+TEST(aligned_allocator_tests, aligned_allocator)
+{
+    for (std::size_t count = 1; count <= 1000; count *= 10)
+    {
+        const dyn_array<std::uint8_t, aligned_allocator<std::uint8_t>> bytes(count, 1);
+        EXPECT_TRUE(is_aligned_to<64>(bytes.data()));
+        EXPECT_EQ(bytes[count - 1], 1);
+
+        const dyn_array<float, aligned_allocator<float, 4096>> page(count, 2.0f);
+        EXPECT_TRUE(is_aligned_to<4096>(page.data()));
+    }
+
+    // the standard containers accept it too
+    std::vector<double, aligned_allocator<double, 32>> values(100, 1.0);
+    values.resize(1000, 2.0);
+    EXPECT_TRUE(is_aligned_to<32>(values.data()));
+
+    // an aligned array can be viewed without checking its alignment again
+    dyn_array<float, aligned_allocator<float>> samples(16, 1.0f);
+    const aligned_span<float, 64> view = aligned<64>(span<float>(samples.data(), samples.size()));
+    EXPECT_EQ(view.size(), 16u);
+
+    // all allocators of an alignment are equal, so moves take the elements
+    const float* const first = samples.data();
+    dyn_array<float, aligned_allocator<float>> moved(std::move(samples), aligned_allocator<float>{});
+    EXPECT_EQ(moved.data(), first);
+    EXPECT_EQ(aligned_allocator<int>{}, aligned_allocator<char>{});
+
+    aligned_allocator<std::uint32_t> allocator;
+    EXPECT_THROW(allocator.allocate(static_cast<std::size_t>(-1) / 2), std::bad_array_new_length);
+}
+
+TEST(aligned_allocator_tests, huge_page_allocator)
+{
+    // large allocations start at a huge page
+    for (std::size_t bytes : {huge_page, huge_page + 1, 3 * huge_page - 4})
+    {
+        dyn_array<std::uint8_t, huge_page_allocator<std::uint8_t>> table(bytes, 7);
+        EXPECT_TRUE(is_aligned_to<huge_page>(table.data()));
+        EXPECT_EQ(table[0], 7);
+        EXPECT_EQ(table[bytes - 1], 7);
+    }
+
+    const dyn_array<std::uint32_t, huge_page_allocator<std::uint32_t>> lookup(
+        huge_page / sizeof(std::uint32_t), std::uint32_t{5});
+    EXPECT_TRUE(is_aligned_to<huge_page>(lookup.data()));
+    const dyn_array<std::uint32_t, huge_page_allocator<std::uint32_t>> copy(lookup);
+    EXPECT_EQ(copy, lookup);
+
+    // small ones are aligned to a cache line
+    const dyn_array<int, huge_page_allocator<int>> small(10, 1);
+    EXPECT_TRUE(is_aligned_to<64>(small.data()));
+    EXPECT_EQ(small[9], 1);
+}
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/aligned_span> // for aligned_span, aligned
+#include <gsl/span>         // for span
+
+#include <cstddef>     // for size_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <numeric>     // for accumulate, iota
+#include <type_traits> // for is_same, is_convertible
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+float sum(span<const float> s) { return std::accumulate(s.begin(), s.end(), 0.0f); }
+
+float sum8(span<const float, 8> s) { return std::accumulate(s.begin(), s.end(), 0.0f); }
+} // namespace
+
+static_assert(sizeof(aligned_span<float, 64>) == sizeof(span<float>),
+              "aligned_span should not store more than a span");
+static_assert(sizeof(aligned_span<float, 64, 16>) == sizeof(span<float, 16>),
+              "a static extent aligned_span should not store more than a span");
+static_assert(std::is_convertible<aligned_span<float, 64>, aligned_span<const float, 32>>::value,
+              "dropping to a weaker alignment should be implicit");
+static_assert(!std::is_convertible<aligned_span<float, 32>, aligned_span<float, 64>>::value,
+              "a stronger alignment must be checked");
+static_assert(!std::is_convertible<span<float>, aligned_span<float, 64>>::value,
+              "constructing an aligned_span checks the alignment and must be explicit");
+static_assert(std::is_convertible<aligned_span<float, 64>, span<const float>>::value, "");
+static_assert(std::is_convertible<aligned_span<float, 64, 8>, span<float, 8>>::value, "");
+
+TEST(aligned_span_tests, construction)
+{
+    alignas(64) float buffer[32] = {};
+    std::iota(buffer, buffer + 32, 0.0f);
+
+    const aligned_span<float, 64> all(span<float>{buffer});
+    EXPECT_EQ(all.size(), 32u);
+    EXPECT_EQ(all.size_bytes(), sizeof(buffer));
+    EXPECT_FALSE(all.empty());
+    EXPECT_EQ(all.data(), buffer);
+    EXPECT_EQ(all[5], 5.0f);
+    EXPECT_EQ(all.alignment, 64u);
+
+    all[5] = 50.0f;
+    EXPECT_EQ(buffer[5], 50.0f);
+
+    const auto fixed = aligned<64>(span<float, 32>{buffer});
+    static_assert(std::is_same<decltype(fixed), const aligned_span<float, 64, 32>>::value, "");
+    EXPECT_EQ(fixed.as_span().data(), buffer);
+
+    const aligned_span<const float, 16> weaker = fixed;
+    EXPECT_EQ(weaker.size(), 32u);
+
+    const aligned_span<float, 64> empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(aligned_span_tests, conversion_to_span)
+{
+    alignas(64) float buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const auto fixed = aligned<32>(span<float, 8>{buffer});
+    const aligned_span<float, 32> dynamic = fixed;
+
+    EXPECT_EQ(sum(dynamic), 36.0f);
+    EXPECT_EQ(sum(fixed), 36.0f);
+    EXPECT_EQ(sum8(fixed), 36.0f);
+
+    const span<float> s = dynamic;
+    EXPECT_EQ(s.data(), buffer);
+    EXPECT_EQ(s.size(), 8u);
+
+    float total = 0;
+    for (float f : dynamic) { total += f; }
+    EXPECT_EQ(total, 36.0f);
+}
+
+TEST(aligned_span_tests, subspan)
+{
+    alignas(64) float buffer[64] = {};
+    std::iota(buffer, buffer + 64, 0.0f);
+    const auto all = aligned<64>(span<float>{buffer});
+
+    const auto second_line = all.subspan<16, 16>();
+    static_assert(std::is_same<decltype(second_line), const aligned_span<float, 64, 16>>::value,
+                  "");
+    EXPECT_EQ(second_line[0], 16.0f);
+
+    const auto tail = all.subspan<48>();
+    static_assert(std::is_same<decltype(tail), const aligned_span<float, 64>>::value, "");
+    EXPECT_EQ(tail.size(), 16u);
+
+    const auto runtime = all.subspan(32, 8);
+    EXPECT_EQ(runtime.data(), buffer + 32);
+    EXPECT_EQ(runtime.size(), 8u);
+    EXPECT_EQ(all.subspan(32).size(), 32u);
+
+    const auto head = all.first<4>();
+    static_assert(std::is_same<decltype(head), const aligned_span<float, 64, 4>>::value, "");
+    EXPECT_EQ(all.first(3).size(), 3u);
+}
+
+TEST(aligned_span_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. aligned_span_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    alignas(64) float buffer[64] = {};
+    const auto all = aligned<64>(span<float>{buffer});
+
+    EXPECT_DEATH(aligned<64>(span<float>{buffer + 1, 4}), expected);
+    EXPECT_DEATH((aligned_span<float, 32>(span<float>{buffer + 4, 4})), expected);
+    EXPECT_DEATH(all.subspan(4), expected);
+    EXPECT_DEATH(all.subspan(80), expected);
+    EXPECT_DEATH(all.subspan(16, 64), expected);
+    EXPECT_DEATH(all.first(65), expected);
+    EXPECT_DEATH(all[64], expected);
+}
@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm> // for min
+#include <chrono>    // for steady_clock, duration
+#include <cstddef>   // for size_t
+#include <cstdio>    // for printf
+
+#ifdef _MSC_VER
+#include <intrin.h> // for _ReadWriteBarrier
+#endif              // _MSC_VER
+
+namespace gsl_benchmark
+{
+
+// Prevents the compiler from discarding a computed value.
+template <class T>
+inline void do_not_optimize(const T& value)
+{
+#ifdef _MSC_VER
+    static const void* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif // _MSC_VER
+}
+
+// Returns the fastest of `repetitions` runs of `f`, in nanoseconds.
+template <class F>
+double measure_ns(F&& f, int repetitions = 10)
+{
+    double best = 0;
+    for (int i = 0; i < repetitions; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+        best = i == 0 ? elapsed : (std::min)(best, elapsed);
+    }
+    return best;
+}
+
+inline void print_header(const char* title)
+{
+    std::printf("\n%s\n", title);
+    std::printf("%-40s %14s %12s\n", "case", "time (us)", "GB/s");
+}
+
+// Prints one result row; `bytes` is the amount of memory touched by one run.
+inline void print_result(const char* name, double ns, std::size_t bytes)
+{
+    std::printf("%-40s %14.1f %12.2f\n", name, ns / 1000.0, static_cast<double>(bytes) / ns);
+}
+
+} // namespace gsl_benchmark
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Measures the bandwidth of gsl::copy with and without a large_copy_policy
+// over a range of sizes, to find where streaming stores and threads start
+// to pay off on a given machine. Each case also reports how long it takes
+// to read a cache-sized working set afterwards, which shows how much of it
+// the copy evicted.
+
+#include <gsl/algorithm>  // for copy
+#include <gsl/large_copy> // for copy, large_copy_policy
+#include <gsl/span>       // for span
+
+#include <algorithm> // for max
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint64_t
+#include <cstdio>    // for printf, snprintf
+#include <numeric>   // for accumulate
+#include <thread>    // for thread
+#include <vector>    // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+constexpr std::size_t working_set_size = std::size_t{1} << 20;
+
+void run(std::size_t bytes, const std::vector<std::uint64_t>& working_set)
+{
+    const std::size_t count = bytes / sizeof(std::uint64_t);
+    std::vector<std::uint64_t> src(count, 1);
+    std::vector<std::uint64_t> dest(count);
+    const gsl::span<const std::uint64_t> s{src};
+    const gsl::span<std::uint64_t> d{dest};
+
+    const unsigned hardware_threads = (std::max)(1u, std::thread::hardware_concurrency());
+
+    gsl::large_copy_policy no_streaming;
+    no_streaming.streaming_threshold = static_cast<std::size_t>(-1);
+    gsl::large_copy_policy streaming;
+    streaming.streaming_threshold = 0;
+    gsl::large_copy_policy parallel = streaming;
+    parallel.parallel_threshold = 0;
+    parallel.max_threads = hardware_threads;
+
+    char title[80];
+    std::snprintf(title, sizeof(title), "copy of %zu KiB (%u hardware threads)", bytes >> 10,
+                  hardware_threads);
+    gsl_benchmark::print_header(title);
+
+    const auto report = [&](const char* name, auto copy) {
+        gsl_benchmark::print_result(name, gsl_benchmark::measure_ns(copy), 2 * bytes);
+        const double reread = gsl_benchmark::measure_ns(
+            [&] {
+                copy();
+                gsl_benchmark::do_not_optimize(std::accumulate(
+                    working_set.begin(), working_set.end(), std::uint64_t{0}));
+            },
+            5);
+        std::printf("%-40s %14.1f\n", "  then read 1 MiB working set", reread / 1000.0);
+    };
+
+    report("gsl::copy", [&] { gsl::copy(s, d); });
+    report("memcpy stores", [&] { gsl::copy(s, d, no_streaming); });
+    report("streaming stores", [&] { gsl::copy(s, d, streaming); });
+    if (hardware_threads > 1)
+        report("streaming stores, all threads", [&] { gsl::copy(s, d, parallel); });
+}
+} // namespace
+
+int main()
+{
+    const std::vector<std::uint64_t> working_set(working_set_size / sizeof(std::uint64_t), 1);
+    for (std::size_t bytes = std::size_t{256} << 10; bytes <= (std::size_t{256} << 20); bytes *= 4)
+        run(bytes, working_set);
+}
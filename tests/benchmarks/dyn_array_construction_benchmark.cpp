@@ -0,0 +1,100 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Measures allocating a dyn_array and then overwriting every element, as
+// when reading a file or decoding into it, with each constructor, and
+// copy-constructing one against std::vector and a plain memcpy. The
+// timings include the page faults of the fresh allocation.
+
+#include <gsl/dyn_array> // for dyn_array, for_overwrite
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint8_t
+#include <cstdio>  // for snprintf
+#include <cstring> // for memcpy, memset
+#include <memory>  // for unique_ptr
+#include <vector>  // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+// stands in for read() or a decoder writing the whole buffer
+void overwrite(gsl::dyn_array<std::uint8_t>& buffer)
+{
+    std::memset(buffer.data(), 0x5a, buffer.size());
+    gsl_benchmark::do_not_optimize(buffer.data());
+}
+
+void run(std::size_t bytes)
+{
+    char title[80];
+    std::snprintf(title, sizeof(title), "allocate and overwrite %zu MiB", bytes >> 20);
+    gsl_benchmark::print_header(title);
+
+    // the pages are faulted in on every repetition, so a few are enough
+    const auto report = [&](const char* name, auto construct) {
+        gsl_benchmark::print_result(name, gsl_benchmark::measure_ns(
+                                              [&] {
+                                                  gsl::dyn_array<std::uint8_t> buffer = construct();
+                                                  overwrite(buffer);
+                                              },
+                                              3),
+                                    bytes);
+    };
+
+    using buffer_type = gsl::dyn_array<std::uint8_t>;
+    report("dyn_array(count)", [&] { return buffer_type(bytes); });
+    report("dyn_array(count, value)", [&] { return buffer_type(bytes, 0); });
+    report("dyn_array(count, for_overwrite)",
+           [&] { return buffer_type(bytes, gsl::for_overwrite); });
+}
+void run_copy(std::size_t bytes)
+{
+    char title[80];
+    std::snprintf(title, sizeof(title), "copy-construct %zu MiB", bytes >> 20);
+    gsl_benchmark::print_header(title);
+
+    const auto report = [&](const char* name, auto copy) {
+        gsl_benchmark::print_result(name, gsl_benchmark::measure_ns(copy, 3), bytes);
+    };
+
+    const gsl::dyn_array<std::uint8_t> source(bytes, 1);
+    const std::vector<std::uint8_t> vector_source(bytes, 1);
+
+    report("dyn_array(const dyn_array&)", [&] {
+        const gsl::dyn_array<std::uint8_t> copy(source);
+        gsl_benchmark::do_not_optimize(copy.data());
+    });
+    report("vector(const vector&)", [&] {
+        const std::vector<std::uint8_t> copy(vector_source);
+        gsl_benchmark::do_not_optimize(copy.data());
+    });
+    report("new[] and memcpy", [&] {
+        const std::unique_ptr<std::uint8_t[]> copy(new std::uint8_t[bytes]);
+        std::memcpy(copy.get(), source.data(), bytes);
+        gsl_benchmark::do_not_optimize(copy.get());
+    });
+}
+} // namespace
+
+int main()
+{
+    for (std::size_t bytes = std::size_t{16} << 20; bytes <= (std::size_t{1} << 30); bytes *= 4)
+        run(bytes);
+    for (std::size_t bytes = std::size_t{16} << 20; bytes <= (std::size_t{256} << 20); bytes *= 4)
+        run_copy(bytes);
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Measures std::sort and std::find through the checked iterators of
+// dyn_array against the iterators of std::vector, and gsl::find, which
+// checks the range once, on the same elements.
+
+#include <gsl/algorithm> // for find
+#include <gsl/dyn_array> // for dyn_array
+#include <gsl/span>      // for span
+
+#include <algorithm> // for copy, find, sort
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t, uint64_t
+#include <cstdio>    // for snprintf
+#include <vector>    // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+std::vector<std::uint32_t> random_values(std::size_t count)
+{
+    std::vector<std::uint32_t> values(count);
+    std::uint64_t state = 88172645463325252ull;
+    for (std::uint32_t& value : values)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        value = static_cast<std::uint32_t>(state >> 32);
+    }
+    return values;
+}
+
+void run(std::size_t count)
+{
+    const std::vector<std::uint32_t> unsorted = random_values(count);
+    const std::size_t bytes = count * sizeof(std::uint32_t);
+    const auto report = [&](const char* name, auto f) {
+        gsl_benchmark::print_result(name, gsl_benchmark::measure_ns(f, 5), bytes);
+    };
+
+    char title[80];
+    std::snprintf(title, sizeof(title), "sort %zu uint32_t", count);
+    gsl_benchmark::print_header(title);
+
+    // each run sorts a fresh copy of the same values
+    std::vector<std::uint32_t> vector(count);
+    gsl::dyn_array<std::uint32_t> array(count);
+    report("std::vector", [&] {
+        std::copy(unsorted.begin(), unsorted.end(), vector.begin());
+        std::sort(vector.begin(), vector.end());
+    });
+    report("gsl::dyn_array", [&] {
+        std::copy(unsorted.begin(), unsorted.end(), array.begin());
+        std::sort(array.begin(), array.end());
+    });
+
+    std::snprintf(title, sizeof(title), "find in %zu uint32_t", count);
+    gsl_benchmark::print_header(title);
+
+    // the value is not there, so the whole range is searched
+    const gsl::dyn_array<std::uint32_t> haystack(unsorted.begin(), unsorted.end());
+    const std::uint32_t missing = 0;
+    report("std::vector", [&] {
+        gsl_benchmark::do_not_optimize(std::find(unsorted.begin(), unsorted.end(), missing));
+    });
+    report("gsl::dyn_array", [&] {
+        gsl_benchmark::do_not_optimize(std::find(haystack.begin(), haystack.end(), missing));
+    });
+    report("gsl::find on a span of the dyn_array", [&] {
+        gsl_benchmark::do_not_optimize(
+            gsl::find(gsl::span<const std::uint32_t>(haystack), missing));
+    });
+}
+} // namespace
+
+int main()
+{
+    for (std::size_t count = std::size_t{1} << 10; count <= (std::size_t{1} << 22); count *= 64)
+        run(count);
+}
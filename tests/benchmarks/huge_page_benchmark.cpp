@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Measures random lookups into tables of 16 MiB to 1 GiB allocated with
+// std::allocator and with huge_page_allocator. Past the reach of the TLB,
+// most lookups into 4 KiB pages also miss the TLB. Whether huge pages are
+// used depends on the transparent huge page setting of the kernel.
+
+#include <gsl/aligned_allocator> // for huge_page_allocator
+#include <gsl/dyn_array>         // for dyn_array
+
+#include <cstddef> // for size_t
+#include <cstdint> // for uint32_t, uint64_t
+#include <cstdio>  // for snprintf
+#include <memory>  // for allocator
+#include <vector>  // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+constexpr std::size_t lookup_count = std::size_t{1} << 22;
+
+template <class Table>
+std::uint64_t lookup(const Table& table, const std::vector<std::uint32_t>& positions)
+{
+    const std::uint32_t* const data = table.data();
+    std::uint64_t sum = 0;
+    for (const std::uint32_t position : positions) sum += data[position];
+    return sum;
+}
+
+template <class Allocator>
+void report(const char* name, std::size_t count, const std::vector<std::uint32_t>& positions)
+{
+    gsl::dyn_array<std::uint32_t, Allocator> table(count, 1u);
+    const auto lookups = [&] { gsl_benchmark::do_not_optimize(lookup(table, positions)); };
+    gsl_benchmark::print_result(name, gsl_benchmark::measure_ns(lookups, 5),
+                                positions.size() * sizeof(std::uint32_t));
+}
+
+void run(std::size_t bytes)
+{
+    const std::size_t count = bytes / sizeof(std::uint32_t);
+
+    // xorshift positions, the same for both tables
+    std::vector<std::uint32_t> positions(lookup_count);
+    std::uint64_t state = 88172645463325252ull;
+    for (std::uint32_t& position : positions)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        position = static_cast<std::uint32_t>(state % count);
+    }
+
+    char title[80];
+    std::snprintf(title, sizeof(title), "%zu random lookups in %zu MiB", lookup_count,
+                  bytes >> 20);
+    gsl_benchmark::print_header(title);
+    report<std::allocator<std::uint32_t>>("std::allocator", count, positions);
+    report<gsl::huge_page_allocator<std::uint32_t>>("gsl::huge_page_allocator", count, positions);
+}
+} // namespace
+
+int main()
+{
+    for (std::size_t bytes = std::size_t{16} << 20; bytes <= (std::size_t{1} << 30); bytes *= 4)
+        run(bytes);
+}
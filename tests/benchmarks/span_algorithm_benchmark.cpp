@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares the span algorithms of <gsl/algorithm> with the standard
+// algorithms running on the checked span iterators, over a buffer that
+// fits in the L2 cache.
+
+#include <gsl/algorithm> // for find, count, min_element, replace, any_of, gather
+#include <gsl/span>      // for span
+#include <gsl/util>      // for at
+
+#include <algorithm> // for any_of, count, find, min_element, replace
+#include <cstddef>   // for size_t
+#include <cstdint>   // for int32_t, uint8_t
+#include <vector>    // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+template <class StdF, class GslF>
+void compare(const char* title, std::size_t bytes, StdF std_version, GslF gsl_version,
+             const char* std_name = "std:: on span iterators")
+{
+    gsl_benchmark::print_header(title);
+    gsl_benchmark::print_result(std_name, gsl_benchmark::measure_ns(std_version), bytes);
+    gsl_benchmark::print_result("gsl::", gsl_benchmark::measure_ns(gsl_version), bytes);
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count = 64 * 1024;
+    std::vector<std::uint8_t> bytes(count, 1);
+    std::vector<std::int32_t> ints(count, 5);
+    ints[count / 2] = -1;
+    const gsl::span<const std::uint8_t> b{bytes};
+    gsl::span<std::int32_t> i{ints};
+    const gsl::span<const std::int32_t> ci{ints};
+
+    compare(
+        "find in 64K uint8_t, not found", b.size_bytes(),
+        [&] { gsl_benchmark::do_not_optimize(std::find(b.begin(), b.end(), 0) - b.begin()); },
+        [&] { gsl_benchmark::do_not_optimize(gsl::find(b, 0)); });
+    compare(
+        "count in 64K uint8_t", b.size_bytes(),
+        [&] { gsl_benchmark::do_not_optimize(std::count(b.begin(), b.end(), 1)); },
+        [&] { gsl_benchmark::do_not_optimize(gsl::count(b, 1)); });
+    compare(
+        "min_element of 64K int32_t", ci.size_bytes(),
+        [&] {
+            gsl_benchmark::do_not_optimize(std::min_element(ci.begin(), ci.end()) - ci.begin());
+        },
+        [&] { gsl_benchmark::do_not_optimize(gsl::min_element(ci)); });
+    compare(
+        "any_of negative in 64K int32_t", ci.size_bytes(),
+        [&] {
+            gsl_benchmark::do_not_optimize(
+                std::any_of(ci.begin(), ci.end(), [](std::int32_t x) { return x < -1; }));
+        },
+        [&] {
+            gsl_benchmark::do_not_optimize(
+                gsl::any_of(ci, [](std::int32_t x) { return x < -1; }));
+        });
+    compare(
+        "replace in 64K int32_t", i.size_bytes(),
+        [&] {
+            std::replace(i.begin(), i.end(), 7, 5);
+            gsl_benchmark::do_not_optimize(ints.data());
+        },
+        [&] {
+            gsl::replace(i, 7, 5);
+            gsl_benchmark::do_not_optimize(ints.data());
+        });
+
+    // dictionary decode of 64K one-byte codes
+    std::vector<std::int32_t> dict(256);
+    std::vector<std::int32_t> decoded(count);
+    for (std::size_t k = 0; k < count; ++k) bytes[k] = static_cast<std::uint8_t>(k * 7);
+    compare(
+        "gather of 64K int32_t by uint8_t", count * (sizeof(std::uint8_t) + sizeof(std::int32_t)),
+        [&] {
+            for (std::size_t k = 0; k < count; ++k) decoded[k] = gsl::at(dict, bytes[k]);
+            gsl_benchmark::do_not_optimize(decoded.data());
+        },
+        [&] {
+            gsl::gather(gsl::span<const std::int32_t>(dict), b, gsl::span<std::int32_t>(decoded));
+            gsl_benchmark::do_not_optimize(decoded.data());
+        },
+        "gsl::at per element");
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares the span comparison operators and gsl::mismatch with the
+// standard algorithms running on the checked span iterators, and with
+// memcmp on the same bytes.
+
+#include <gsl/algorithm> // for mismatch
+#include <gsl/span>      // for span, operator==, operator<
+
+#include <algorithm> // for equal, lexicographical_compare, mismatch
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint32_t
+#include <cstring>   // for memcmp
+#include <numeric>   // for iota
+#include <vector>    // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+using element = std::uint32_t;
+
+// one comparison per pair of neighbouring keys, as in a sorted store
+template <class Less>
+std::size_t count_ordered_keys(const std::vector<unsigned char>& keys, std::size_t key_size,
+                               Less less)
+{
+    std::size_t ordered = 0;
+    const std::size_t count = keys.size() / key_size;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        const gsl::span<const unsigned char> a{keys.data() + (i - 1) * key_size, key_size};
+        const gsl::span<const unsigned char> b{keys.data() + i * key_size, key_size};
+        if (less(a, b)) ++ordered;
+    }
+    return ordered;
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count = 10'000'000;
+    std::vector<element> buffer1(count);
+    std::iota(buffer1.begin(), buffer1.end(), element{0});
+    std::vector<element> buffer2 = buffer1;
+    buffer2.back() = 0;
+    const gsl::span<const element> s1{buffer1};
+    const gsl::span<const element> s2{buffer2};
+    const std::size_t bytes = 2 * s1.size_bytes();
+
+    gsl_benchmark::print_header("equality of 10M uint32_t, differing in the last element");
+    gsl_benchmark::print_result("std::equal on span iterators", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(
+                                        std::equal(s1.begin(), s1.end(), s2.begin(), s2.end()));
+                                }),
+                                bytes);
+    gsl_benchmark::print_result(
+        "span operator==",
+        gsl_benchmark::measure_ns([&] { gsl_benchmark::do_not_optimize(s1 == s2); }), bytes);
+    gsl_benchmark::print_result("memcmp", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(
+                                        std::memcmp(s1.data(), s2.data(), s1.size_bytes()));
+                                }),
+                                bytes);
+
+    gsl_benchmark::print_header("first difference in 10M uint32_t");
+    gsl_benchmark::print_result("std::mismatch on span iterators", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(
+                                        std::mismatch(s1.begin(), s1.end(), s2.begin()).first -
+                                        s1.begin());
+                                }),
+                                bytes);
+    gsl_benchmark::print_result(
+        "gsl::mismatch",
+        gsl_benchmark::measure_ns([&] { gsl_benchmark::do_not_optimize(gsl::mismatch(s1, s2)); }),
+        bytes);
+
+    constexpr std::size_t key_size = 32;
+    std::vector<unsigned char> keys(key_size * 1'000'000);
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<unsigned char>(i % key_size == key_size - 1 ? i / key_size : 7);
+    const std::size_t key_bytes = 2 * keys.size();
+
+    gsl_benchmark::print_header("operator< on 1M pairs of 32-byte keys");
+    gsl_benchmark::print_result(
+        "std::lexicographical_compare on iterators", gsl_benchmark::measure_ns([&] {
+            gsl_benchmark::do_not_optimize(count_ordered_keys(
+                keys, key_size,
+                [](gsl::span<const unsigned char> a, gsl::span<const unsigned char> b) {
+                    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+                }));
+        }),
+        key_bytes);
+    gsl_benchmark::print_result(
+        "span operator<", gsl_benchmark::measure_ns([&] {
+            gsl_benchmark::do_not_optimize(count_ordered_keys(
+                keys, key_size,
+                [](gsl::span<const unsigned char> a, gsl::span<const unsigned char> b) {
+                    return a < b;
+                }));
+        }),
+        key_bytes);
+    gsl_benchmark::print_result(
+        "memcmp", gsl_benchmark::measure_ns([&] {
+            gsl_benchmark::do_not_optimize(count_ordered_keys(
+                keys, key_size,
+                [](gsl::span<const unsigned char> a, gsl::span<const unsigned char> b) {
+                    return std::memcmp(a.data(), b.data(), a.size()) < 0;
+                }));
+        }),
+        key_bytes);
+}
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares gsl::content_hash with std::hash<std::string>, and looking up
+// std::string keys received as spans through a temporary string and, in
+// C++20, directly with the transparent span_hash and span_equal.
+
+#include <gsl/span>      // for span
+#include <gsl/span_hash> // for content_hash, span_hash, span_equal
+
+#include <cstddef>       // for size_t
+#include <functional>    // for hash
+#include <string>        // for string, to_string
+#include <unordered_map> // for unordered_map
+#include <vector>        // for vector
+
+#include "benchmark_common.h"
+
+int main()
+{
+    const std::string block(4096, 'x');
+    gsl_benchmark::print_header("hash of a 4 KiB buffer");
+    gsl_benchmark::print_result("std::hash<std::string>", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(std::hash<std::string>{}(block));
+                                }),
+                                block.size());
+    gsl_benchmark::print_result("gsl::content_hash", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(
+                                        gsl::content_hash(gsl::span<const char>(block)));
+                                }),
+                                block.size());
+
+    // keys longer than the small string buffer, so that building one allocates
+    constexpr std::size_t key_count = 10'000;
+    std::unordered_map<std::string, std::size_t, gsl::span_hash<char>, gsl::span_equal<char>> ids;
+    std::string received;
+    std::vector<gsl::span<const char>> keys;
+    for (std::size_t i = 0; i < key_count; ++i)
+    {
+        std::string key = "session-identifier-" + std::to_string(i);
+        ids.emplace(key, i);
+        received += key;
+    }
+    for (std::size_t i = 0, offset = 0; i < key_count; ++i)
+    {
+        const std::size_t size = ("session-identifier-" + std::to_string(i)).size();
+        keys.push_back(gsl::span<const char>(received).subspan(offset, size));
+        offset += size;
+    }
+
+    gsl_benchmark::print_header("10K lookups of std::string keys received as spans");
+    gsl_benchmark::print_result("find(std::string(key))", gsl_benchmark::measure_ns([&] {
+                                    std::size_t found = 0;
+                                    for (const auto key : keys)
+                                        found += ids.count(std::string(key.begin(), key.end()));
+                                    gsl_benchmark::do_not_optimize(found);
+                                }),
+                                received.size());
+#if defined(__cpp_lib_generic_unordered_lookup)
+    gsl_benchmark::print_result("find(key)", gsl_benchmark::measure_ns([&] {
+                                    std::size_t found = 0;
+                                    for (const auto key : keys) found += ids.count(key);
+                                    gsl_benchmark::do_not_optimize(found);
+                                }),
+                                received.size());
+#endif
+}
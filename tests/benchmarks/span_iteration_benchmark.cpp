@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares walking a gsl::span through its bounds-carrying iterator, through
+// operator[], through the single-pointer iterator of gsl::unchecked and
+// through a raw pointer loop.
+
+#include <gsl/span>       // for span
+#include <gsl/span_views> // for unchecked
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t
+#include <cstdio>   // for printf
+#include <numeric>  // for iota
+#include <vector>   // for vector
+
+#include "benchmark_common.h"
+
+namespace
+{
+using element = std::uint32_t;
+
+element sum_span_iterator(gsl::span<const element> s)
+{
+    element sum = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) sum += *it;
+    return sum;
+}
+
+element sum_span_index(gsl::span<const element> s)
+{
+    element sum = 0;
+    for (std::size_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+element sum_unchecked(gsl::span<const element> s)
+{
+    element sum = 0;
+    for (const element e : gsl::unchecked(s)) sum += e;
+    return sum;
+}
+
+element sum_raw_pointer(const element* first, std::size_t count)
+{
+    element sum = 0;
+    for (const element* last = first + count; first != last; ++first) sum += *first;
+    return sum;
+}
+} // namespace
+
+int main()
+{
+    constexpr std::size_t count = 10'000'000;
+    std::vector<element> buffer(count);
+    std::iota(buffer.begin(), buffer.end(), element{0});
+    const gsl::span<const element> s{buffer};
+    const std::size_t bytes = s.size_bytes();
+
+    std::printf("sizeof(span<T>::iterator)          = %zu\n",
+                sizeof(gsl::span<const element>::iterator));
+    std::printf("sizeof(unchecked_view<T>::iterator) = %zu\n",
+                sizeof(gsl::unchecked_view<const element>::iterator));
+
+    gsl_benchmark::print_header("sum of 10M uint32_t");
+    gsl_benchmark::print_result(
+        "span iterator",
+        gsl_benchmark::measure_ns([&] { gsl_benchmark::do_not_optimize(sum_span_iterator(s)); }),
+        bytes);
+    gsl_benchmark::print_result(
+        "span operator[]",
+        gsl_benchmark::measure_ns([&] { gsl_benchmark::do_not_optimize(sum_span_index(s)); }),
+        bytes);
+    gsl_benchmark::print_result(
+        "gsl::unchecked",
+        gsl_benchmark::measure_ns([&] { gsl_benchmark::do_not_optimize(sum_unchecked(s)); }),
+        bytes);
+    gsl_benchmark::print_result("raw pointer", gsl_benchmark::measure_ns([&] {
+                                    gsl_benchmark::do_not_optimize(
+                                        sum_raw_pointer(buffer.data(), buffer.size()));
+                                }),
+                                bytes);
+}
@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/compact_span> // for compact_span
+#include <gsl/span>         // for span
+
+#include <algorithm>   // for sort
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint16_t, uint32_t, uint64_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <numeric>     // for accumulate
+#include <type_traits> // for is_convertible
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+std::uint32_t sum(span<const std::uint32_t> s)
+{
+    return std::accumulate(s.begin(), s.end(), std::uint32_t{0});
+}
+
+struct index_node
+{
+    compact_span<const std::uint32_t> postings[4];
+};
+} // namespace
+
+static_assert(sizeof(compact_span<const std::uint32_t>) == sizeof(void*) + sizeof(std::uint32_t),
+              "compact_span should not be padded to the alignment of a pointer");
+static_assert(alignof(compact_span<const std::uint32_t>) == alignof(std::uint32_t), "");
+static_assert(sizeof(compact_span<char, std::uint16_t>) == sizeof(void*) + sizeof(std::uint16_t),
+              "");
+static_assert(sizeof(index_node) == 4 * sizeof(compact_span<const std::uint32_t>), "");
+static_assert(!std::is_convertible<span<int>, compact_span<int>>::value,
+              "converting from a span checks its size and must be explicit");
+static_assert(std::is_convertible<compact_span<int>, span<const int>>::value, "");
+static_assert(std::is_convertible<compact_span<int, std::uint16_t>, compact_span<const int>>::value,
+              "");
+static_assert(!std::is_convertible<compact_span<int>, compact_span<int, std::uint16_t>>::value, "");
+
+TEST(compact_span_tests, construction)
+{
+    std::vector<std::uint32_t> vec{5, 3, 1, 4, 2};
+
+    const compact_span<std::uint32_t> cs(span<std::uint32_t>{vec});
+    EXPECT_EQ(cs.size(), 5u);
+    EXPECT_EQ(cs.size_bytes(), 5 * sizeof(std::uint32_t));
+    EXPECT_FALSE(cs.empty());
+    EXPECT_EQ(cs.data(), vec.data());
+    EXPECT_EQ(cs[3], 4u);
+    EXPECT_EQ(cs.front(), 5u);
+    EXPECT_EQ(cs.back(), 2u);
+
+    const compact_span<const std::uint32_t> from_pointer(vec.data(), 2);
+    EXPECT_EQ(from_pointer.size(), 2u);
+
+    const compact_span<int> empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.data(), nullptr);
+    EXPECT_EQ(empty.begin(), empty.end());
+
+    EXPECT_EQ((compact_span<char, std::uint16_t>::max_size()), 65535u);
+}
+
+TEST(compact_span_tests, conversions)
+{
+    std::vector<std::uint32_t> vec{1, 2, 3, 4};
+    const compact_span<std::uint32_t> cs(span<std::uint32_t>{vec});
+
+    EXPECT_EQ(sum(cs), 10u);
+
+    const span<std::uint32_t> wide = cs;
+    EXPECT_EQ(wide.data(), vec.data());
+    EXPECT_EQ(wide.size(), 4u);
+    EXPECT_EQ(cs.as_span().size(), 4u);
+
+    index_node node{};
+    node.postings[1] = compact_span<const std::uint32_t>(span<const std::uint32_t>{vec}.last(2));
+    EXPECT_EQ(sum(node.postings[1]), 7u);
+    EXPECT_TRUE(node.postings[0].empty());
+}
+
+TEST(compact_span_tests, subviews_and_iteration)
+{
+    std::vector<std::uint32_t> vec{5, 3, 1, 4, 2};
+    const compact_span<std::uint32_t> cs(span<std::uint32_t>{vec});
+
+    EXPECT_EQ(cs.first(2).back(), 3u);
+    EXPECT_EQ(cs.last(2).front(), 4u);
+    EXPECT_EQ(cs.subspan(1, 3).size(), 3u);
+    EXPECT_EQ(cs.subspan(1, 3)[2], 4u);
+    EXPECT_EQ(cs.subspan(2).size(), 3u);
+    EXPECT_TRUE(cs.subspan(5).empty());
+
+    std::sort(cs.begin(), cs.end());
+    EXPECT_EQ(vec, (std::vector<std::uint32_t>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(*cs.rbegin(), 5u);
+    EXPECT_EQ(cs.end() - cs.begin(), 5);
+}
+
+TEST(compact_span_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. compact_span_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::vector<char> big(70000);
+    std::vector<std::uint32_t> vec{1, 2, 3};
+    const compact_span<std::uint32_t> cs(span<std::uint32_t>{vec});
+
+    EXPECT_DEATH((compact_span<char, std::uint16_t>(span<char>{big})), expected);
+    EXPECT_DEATH((compact_span<char, std::uint16_t>(big.data(), 65536)), expected);
+    EXPECT_DEATH((compact_span<char>(nullptr, 1)), expected);
+    EXPECT_DEATH(cs[3], expected);
+    EXPECT_DEATH(cs.first(4), expected);
+    EXPECT_DEATH(cs.last(4), expected);
+    EXPECT_DEATH(cs.subspan(4), expected);
+    EXPECT_DEATH(cs.subspan(1, 3), expected);
+    EXPECT_DEATH(cs.subspan(3).front(), expected);
+    EXPECT_DEATH(*cs.end(), expected);
+}
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/cow_buffer> // for cow_buffer
+#include <gsl/span>       // for span
+
+#include <cstddef>   // for size_t
+#include <exception> // for terminate
+#include <iostream>  // for cerr
+#include <numeric>   // for accumulate
+#include <string>    // for string
+#include <thread>    // for thread
+#include <utility>   // for move
+#include <vector>    // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+int sum(span<const int> s) { return std::accumulate(s.begin(), s.end(), 0); }
+} // namespace
+
+static_assert(sizeof(cow_buffer<int>) == sizeof(void*),
+              "a cow_buffer should only store a pointer to its shared block");
+
+TEST(cow_buffer_tests, construction)
+{
+    const cow_buffer<int> zeros(4);
+    EXPECT_EQ(zeros.size(), 4u);
+    EXPECT_EQ(zeros.size_bytes(), 4 * sizeof(int));
+    EXPECT_FALSE(zeros.empty());
+    EXPECT_EQ(zeros[3], 0);
+    EXPECT_EQ(zeros.use_count(), 1u);
+
+    const std::vector<std::string> words{"packet", "template"};
+    const cow_buffer<std::string> copied{span<const std::string>(words)};
+    EXPECT_EQ(copied[1], "template");
+    EXPECT_NE(copied.data(), words.data());
+
+    cow_buffer<int> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.data(), nullptr);
+    EXPECT_EQ(empty.use_count(), 0u);
+    EXPECT_TRUE(empty.writable().empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(cow_buffer_tests, copies_share_until_written)
+{
+    const int init[] = {1, 2, 3, 4};
+    cow_buffer<int> original{span<const int>(init)};
+
+    cow_buffer<int> clone = original;
+    EXPECT_EQ(original.use_count(), 2u);
+    EXPECT_EQ(clone.data(), original.data());
+    EXPECT_EQ(sum(clone.view()), 10);
+    EXPECT_EQ(sum(clone), 10);
+
+    // writing to a shared buffer detaches it
+    const span<int> w = clone.writable();
+    EXPECT_NE(w.data(), original.data());
+    EXPECT_EQ(original.use_count(), 1u);
+    EXPECT_EQ(clone.use_count(), 1u);
+    w[0] = 100;
+    EXPECT_EQ(clone[0], 100);
+    EXPECT_EQ(original[0], 1);
+
+    // writing to a buffer that is not shared does not copy
+    const int* const before = clone.data();
+    EXPECT_EQ(clone.writable().data(), before);
+
+    cow_buffer<int> moved = std::move(clone);
+    EXPECT_EQ(moved.data(), before);
+    EXPECT_EQ(moved.use_count(), 1u);
+
+    cow_buffer<int> assigned;
+    assigned = moved;
+    EXPECT_EQ(moved.use_count(), 2u);
+    assigned = original;
+    EXPECT_EQ(moved.use_count(), 1u);
+    EXPECT_EQ(original.use_count(), 2u);
+}
+
+TEST(cow_buffer_tests, copies_across_threads)
+{
+    cow_buffer<int> config(256);
+    span<int> w = config.writable();
+    for (std::size_t i = 0; i < w.size(); ++i) w[i] = static_cast<int>(i);
+
+    std::vector<int> sums(4);
+    std::vector<std::thread> requests;
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+        requests.emplace_back([config, &sums, t] {
+            for (int k = 0; k < 100; ++k)
+            {
+                cow_buffer<int> snapshot = config;
+                if (t == 0) snapshot.writable()[0] = -1;
+                sums[t] = sum(snapshot.view());
+            }
+        });
+    }
+    for (auto& r : requests) r.join();
+
+    EXPECT_EQ(config.use_count(), 1u);
+    EXPECT_EQ(config[0], 0);
+    EXPECT_EQ(sums[1], 255 * 256 / 2);
+    EXPECT_EQ(sums[0], 255 * 256 / 2 - 1);
+}
+
+TEST(cow_buffer_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. cow_buffer_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const cow_buffer<int> buffer(4);
+    EXPECT_DEATH(buffer[4], expected);
+    EXPECT_DEATH(*buffer.end(), expected);
+}
@@ -2,13 +2,18 @@
 
 #include "deathTestCommon.h"
 #include "gsl/dyn_array"
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <gsl/dyn_array>
 #include <gsl/util>
 #include <iostream>
+#include <numeric>
 #include <sstream>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 // Despite using <algorithm> and <ranges> utilities in this test, they
 // are not being included directly by this file as a test to ensure
@@ -25,6 +30,12 @@ static_assert(std::input_iterator<gsl::dyn_array<int>::iterator>,
 #if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
 static_assert(std::ranges::input_range<gsl::dyn_array<int>>,
               "gsl::dyn_array should be a valid input range");
+static_assert(std::contiguous_iterator<gsl::dyn_array<int>::iterator>,
+              "gsl::dyn_array should expose a contiguous_iterator");
+static_assert(std::contiguous_iterator<gsl::dyn_array<int>::const_iterator>,
+              "gsl::dyn_array should expose a contiguous const_iterator");
+static_assert(std::ranges::contiguous_range<gsl::dyn_array<int>>,
+              "gsl::dyn_array should be a contiguous range");
 #endif /* __cpp_lib_ranges >= 201911L */
 
 TEST(dyn_array_tests, default_ctor)
@@ -84,6 +95,21 @@ TEST(dyn_array_tests, copy_ctor)
     EXPECT_TRUE(std::all_of(guardians.begin(), guardians.end(), [](char c) { return c == 'c'; }));
 }
 
+TEST(dyn_array_tests, equality)
+{
+    gsl::dyn_array<int> scores(100, 7);
+    gsl::dyn_array<int> copies(scores);
+    EXPECT_TRUE(scores == copies);
+    copies[99] = 8;
+    EXPECT_TRUE(scores != copies);
+    EXPECT_TRUE(scores != gsl::dyn_array<int>(99, 7));
+    EXPECT_TRUE(gsl::dyn_array<int>() == gsl::dyn_array<int>());
+
+    gsl::dyn_array<std::string> names{"a", "b"};
+    EXPECT_TRUE(names == gsl::dyn_array<std::string>({"a", "b"}));
+    EXPECT_FALSE(names == gsl::dyn_array<std::string>({"a", "c"}));
+}
+
 TEST(dyn_array_tests, access_operator)
 {
     gsl::dyn_array<char> rockies(10, 'c');
@@ -152,6 +178,28 @@ constexpr auto default_constructed_count_dyn_array_is_constexpr()
     return values.size() == 3 && values[0] == 0 && values[1] == 0 && values[2] == 0;
 }
 
+constexpr auto moved_dyn_array_is_constexpr()
+{
+    gsl::dyn_array<int> values(3, 7);
+    gsl::dyn_array<int> moved{std::move(values)};
+    values = std::move(moved);
+    return values.size() == 3 && values[2] == 7 && moved.empty();
+}
+
+constexpr auto overwritten_dyn_array_is_constexpr()
+{
+    gsl::dyn_array<int> values(3, gsl::for_overwrite);
+    values[0] = values[1] = values[2] = 5;
+    return values[0] + values[1] + values[2] == 15;
+}
+
+constexpr auto copied_dyn_array_is_constexpr()
+{
+    const gsl::dyn_array<int> values{1, 2, 3};
+    const gsl::dyn_array<int> copy(values);
+    return copy == values;
+}
+
 TEST(dyn_array_tests, constexprness)
 {
     constexpr gsl::dyn_array<char> marlins;
@@ -162,6 +210,9 @@ TEST(dyn_array_tests, constexprness)
     static_assert(marlins.begin() == marlins.end());
     static_assert(std::distance(marlins.begin(), marlins.end()) == 0);
     static_assert(default_constructed_count_dyn_array_is_constexpr());
+    static_assert(moved_dyn_array_is_constexpr());
+    static_assert(overwritten_dyn_array_is_constexpr());
+    static_assert(copied_dyn_array_is_constexpr());
 }
 #endif /* __cpp_lib_constexpr_dynamic_alloc >= 201907L */
 
@@ -462,6 +513,24 @@ constexpr auto operator!=(const OwnershipTrackingAllocator<T>& lhs,
     return !(lhs == rhs);
 }
 
+// an OwnershipTrackingAllocator that moves with the elements
+template <typename T>
+class PropagatingAllocator : public OwnershipTrackingAllocator<T>
+{
+public:
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    PropagatingAllocator() noexcept = default;
+
+    explicit PropagatingAllocator(int owner) noexcept : OwnershipTrackingAllocator<T>(owner) {}
+
+    template <typename U>
+    PropagatingAllocator(const PropagatingAllocator<U>& other) noexcept
+        : OwnershipTrackingAllocator<T>(other.owner())
+    {}
+};
+
 TEST(dyn_array_tests, custom_allocator_models_allocator)
 {
     using traits = std::allocator_traits<Newocator<char>>;
@@ -506,6 +575,93 @@ TEST(dyn_array_tests, custom_allocator)
     Newocator<char>::check();
 }
 
+TEST(dyn_array_tests, move)
+{
+    static_assert(std::is_nothrow_move_constructible<gsl::dyn_array<std::string>>::value,
+                  "moving a dyn_array should not throw");
+    static_assert(std::is_nothrow_move_assignable<gsl::dyn_array<std::string>>::value,
+                  "moving a dyn_array with std::allocator should not throw");
+
+    gsl::dyn_array<std::string> rockies(3, std::string(40, 'r'));
+    const std::string* const elements = rockies.data();
+
+    gsl::dyn_array<std::string> moved{std::move(rockies)};
+    EXPECT_EQ(moved.data(), elements);
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(rockies.empty());
+    EXPECT_EQ(rockies.data(), nullptr);
+    EXPECT_EQ(rockies.begin(), rockies.end());
+
+    gsl::dyn_array<std::string> assigned(1);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.data(), elements);
+    EXPECT_TRUE(moved.empty());
+
+    // the moved-from array can be assigned to again
+    moved = std::move(assigned);
+    EXPECT_EQ(moved.data(), elements);
+    moved = std::move(moved);
+    EXPECT_EQ(moved.data(), elements);
+
+    std::vector<gsl::dyn_array<int>> buffers;
+    for (int i = 0; i < 10; ++i) buffers.emplace_back(gsl::dyn_array<int>(4, i));
+    EXPECT_EQ(buffers[9][3], 9);
+
+    gsl::dyn_array<int> other{1, 2};
+    swap(buffers[0], other);
+    EXPECT_EQ(buffers[0].size(), 2);
+    EXPECT_EQ(other[3], 0);
+}
+
+TEST(dyn_array_tests, move_with_allocators)
+{
+    OwnershipTrackingAllocator<int>::reset();
+    {
+        using tracked = gsl::dyn_array<int, OwnershipTrackingAllocator<int>>;
+        tracked first(4, 1, OwnershipTrackingAllocator<int>(1));
+        const int* const elements = first.data();
+
+        // equal allocators: the elements are taken
+        tracked second(std::move(first), OwnershipTrackingAllocator<int>(1));
+        EXPECT_EQ(second.data(), elements);
+
+        // unequal allocators that do not propagate: the elements are moved
+        tracked third(std::move(second), OwnershipTrackingAllocator<int>(2));
+        EXPECT_NE(third.data(), elements);
+        EXPECT_TRUE(second.empty());
+        EXPECT_EQ(third.get_allocator().owner(), 2);
+        EXPECT_EQ(third[3], 1);
+
+        tracked fourth(2, 5, OwnershipTrackingAllocator<int>(3));
+        fourth = std::move(third);
+        EXPECT_EQ(fourth.get_allocator().owner(), 3);
+        EXPECT_EQ(fourth.size(), 4);
+        EXPECT_TRUE(third.empty());
+    }
+    EXPECT_EQ(OwnershipTrackingAllocator<int>::mismatched_deallocations(), 0);
+
+    OwnershipTrackingAllocator<int>::reset();
+    {
+        using propagating = gsl::dyn_array<int, PropagatingAllocator<int>>;
+        static_assert(std::is_nothrow_move_assignable<propagating>::value,
+                      "a propagating allocator moves without copying elements");
+
+        propagating first(4, 1, PropagatingAllocator<int>(1));
+        const int* const elements = first.data();
+        propagating second(2, 5, PropagatingAllocator<int>(2));
+        second = std::move(first);
+        EXPECT_EQ(second.data(), elements);
+        EXPECT_EQ(second.get_allocator().owner(), 1);
+
+        propagating third(1, 7, PropagatingAllocator<int>(3));
+        swap(second, third);
+        EXPECT_EQ(third.data(), elements);
+        EXPECT_EQ(third.get_allocator().owner(), 1);
+        EXPECT_EQ(second.get_allocator().owner(), 3);
+    }
+    EXPECT_EQ(OwnershipTrackingAllocator<int>::mismatched_deallocations(), 0);
+}
+
 TEST(dyn_array_tests, non_trivial_elements_are_destroyed)
 {
     LifetimeCounter::alive_count = 0;
@@ -532,6 +688,108 @@ TEST(dyn_array_tests, count_constructor_default_constructs_each_element)
     EXPECT_EQ(DefaultConstructionCounter::copy_constructor_count, 0);
 }
 
+TEST(dyn_array_tests, for_overwrite_ctor)
+{
+    gsl::dyn_array<int> reds(100, gsl::for_overwrite);
+    EXPECT_EQ(reds.size(), 100);
+    std::fill(reds.begin(), reds.end(), 7);
+    EXPECT_EQ(reds[99], 7);
+
+    gsl::dyn_array<int> empty(0, gsl::for_overwrite);
+    EXPECT_EQ(empty.data(), nullptr);
+
+    // elements that are not trivial are still default-constructed
+    DefaultConstructionCounter::reset();
+    {
+        gsl::dyn_array<DefaultConstructionCounter> values(4, gsl::for_overwrite);
+        EXPECT_EQ(values.size(), 4);
+    }
+    EXPECT_EQ(DefaultConstructionCounter::default_constructor_count, 4);
+
+    const gsl::dyn_array<std::string> strings(3, gsl::for_overwrite);
+    EXPECT_TRUE(strings[2].empty());
+
+    Newocator<char>::init();
+    {
+        gsl::dyn_array<char, Newocator<char>> twins(10, gsl::for_overwrite);
+        twins[9] = 't';
+        EXPECT_EQ(twins[9], 't');
+    }
+    Newocator<char>::check();
+}
+
+template <typename T>
+struct ConstructCountingAllocator : std::allocator<T>
+{
+    using value_type = T;
+
+    static int constructed;
+
+    ConstructCountingAllocator() = default;
+
+    template <typename U>
+    ConstructCountingAllocator(const ConstructCountingAllocator<U>&) noexcept
+    {}
+
+    template <typename U, typename... Args>
+    void construct(U* ptr, Args&&... args)
+    {
+        ++constructed;
+        ::new (static_cast<void*>(ptr)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    struct rebind
+    {
+        using other = ConstructCountingAllocator<U>;
+    };
+};
+
+template <typename T>
+int ConstructCountingAllocator<T>::constructed = 0;
+
+TEST(dyn_array_tests, trivial_elements_are_constructed_bytewise)
+{
+    struct Point
+    {
+        int x;
+        int y;
+    };
+
+    gsl::dyn_array<std::uint8_t> bytes(1000);
+    EXPECT_TRUE(std::all_of(bytes.begin(), bytes.end(), [](std::uint8_t b) { return b == 0; }));
+    std::iota(bytes.begin(), bytes.end(), std::uint8_t{0});
+    const gsl::dyn_array<std::uint8_t> copy(bytes);
+    EXPECT_EQ(copy, bytes);
+
+    const gsl::dyn_array<Point> points(5, Point{1, 2});
+    const gsl::dyn_array<Point> copied_points(points);
+    EXPECT_EQ(copied_points[4].x, 1);
+    EXPECT_EQ(copied_points[4].y, 2);
+
+    const gsl::dyn_array<int> empty;
+    const gsl::dyn_array<int> empty_copy(empty);
+    EXPECT_EQ(empty_copy.data(), nullptr);
+
+    const std::vector<int> source{1, 2, 3};
+    const gsl::dyn_array<int> from_pointers(source.data(), source.data() + source.size());
+    EXPECT_EQ(from_pointers[2], 3);
+
+    int* const null_pointer = nullptr;
+    const gsl::dyn_array<int> from_empty_range(null_pointer, null_pointer);
+    EXPECT_TRUE(from_empty_range.empty());
+
+    // an allocator with its own construct() still constructs every element
+    using counting_allocator = ConstructCountingAllocator<int>;
+    counting_allocator::constructed = 0;
+    gsl::dyn_array<int, counting_allocator> counted(3);
+    const gsl::dyn_array<int, counting_allocator> counted_value(3, 7);
+    const gsl::dyn_array<int, counting_allocator> counted_copy(counted_value);
+    EXPECT_EQ(counting_allocator::constructed, 9);
+    EXPECT_EQ(counted[2], 0);
+    EXPECT_EQ(counted_copy[2], 7);
+}
+
 #ifdef GSL_DYN_ARRAY_COMPILE_FAILURE_TESTS
 TEST(dyn_array_compile_failure_tests, count_constructor_accepts_default_constructible_only_elements)
 {
@@ -588,6 +846,31 @@ TEST(dyn_array_tests, random_access_iterator_arithmetic)
     EXPECT_EQ(third - first, 2);
     EXPECT_EQ(*(third - 1), 'b');
     EXPECT_EQ(*std::prev(third), 'b');
+    EXPECT_EQ(bluejays.end() - bluejays.begin(), 4);
+    EXPECT_EQ(bluejays.end() - 4, first);
+
+    third += -2;
+    EXPECT_EQ(third, first);
+    third -= -4;
+    EXPECT_EQ(third, bluejays.end());
+
+    const gsl::dyn_array<char>::iterator singular{};
+    EXPECT_EQ(singular, gsl::dyn_array<char>::iterator{});
+    EXPECT_EQ(gsl::dyn_array<char>{}.begin(), gsl::dyn_array<char>{}.end());
+}
+
+TEST(dyn_array_tests, sort_and_find)
+{
+    gsl::dyn_array<int> values{5, 3, 9, 1, 7};
+    std::sort(values.begin(), values.end());
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[4], 9);
+
+    const auto found = std::find(values.cbegin(), values.cend(), 7);
+    ASSERT_NE(found, values.cend());
+    EXPECT_EQ(found - values.cbegin(), 3);
+    EXPECT_EQ(std::find(values.begin(), values.end(), 4), values.end());
 }
 
 TEST(dyn_array_tests, random_access_iterator_arithmetic_accepts_negative_offsets)
@@ -605,6 +888,28 @@ TEST(dyn_array_tests, random_access_iterator_arithmetic_accepts_negative_offsets
     EXPECT_EQ(next, 'd');
 }
 
+TEST(dyn_array_tests, random_access_iterator_ordering)
+{
+    gsl::dyn_array<char> bluejays{'a', 'b', 'c', 'd'};
+
+    auto first = bluejays.begin();
+    auto second = 1 + first;
+
+    EXPECT_TRUE(first < second);
+    EXPECT_TRUE(second > first);
+    EXPECT_TRUE(first <= first);
+    EXPECT_TRUE(second >= first);
+    EXPECT_FALSE(second < first);
+    EXPECT_EQ(first[3], 'd');
+    EXPECT_EQ(second[-1], 'a');
+    EXPECT_EQ(std::pointer_traits<decltype(first)>::to_address(bluejays.end()),
+              bluejays.data() + bluejays.size());
+
+    std::sort(bluejays.rbegin(), bluejays.rend());
+    EXPECT_EQ(bluejays[0], 'd');
+    EXPECT_EQ(bluejays[3], 'a');
+}
+
 TEST(dyn_array_tests, input_iterator_constructor)
 {
     std::istringstream stream{"n a t s"};
@@ -636,6 +941,18 @@ TEST(dyn_array_tests, contract_violations)
     EXPECT_DEATH(++values.end(), expected);
     EXPECT_DEATH(--values.begin(), expected);
     EXPECT_DEATH((void) (values.begin() == other.begin()), expected);
+    EXPECT_DEATH((void) (values.begin() < other.begin()), expected);
+    EXPECT_DEATH((void) values.end()[0], expected);
+    EXPECT_DEATH((void) (values.begin() + 4), expected);
+    EXPECT_DEATH((void) (values.end() - 4), expected);
+    EXPECT_DEATH((void) (values.begin() + -1), expected);
+    EXPECT_DEATH((void) (values.end() - other.begin()), expected);
+
+    // allocators that do not propagate must be equal to swap
+    using tracked = gsl::dyn_array<int, OwnershipTrackingAllocator<int>>;
+    tracked first(1, 1, OwnershipTrackingAllocator<int>(1));
+    tracked second(1, 2, OwnershipTrackingAllocator<int>(2));
+    EXPECT_DEATH(swap(first, second), expected);
 }
 
 #ifdef _MSC_VER
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/large_copy> // for copy, large_copy_policy
+#include <gsl/span>       // for span
+
+#include <array>     // for array
+#include <cstddef>   // for size_t
+#include <cstdint>   // for uint8_t, uint32_t
+#include <exception> // for terminate
+#include <iostream>  // for cerr
+#include <string>    // for string
+#include <vector>    // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+// copies src into dest at every offset of a cache line, so that both the
+// unaligned head and tail of the streaming copy are exercised
+void check_all_offsets(const large_copy_policy& policy)
+{
+    std::vector<std::uint8_t> src(1000);
+    for (std::size_t i = 0; i < src.size(); ++i) src[i] = static_cast<std::uint8_t>(i * 7);
+
+    for (std::size_t offset = 0; offset < 64; ++offset)
+    {
+        for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{63},
+                                        std::size_t{64}, std::size_t{129}, std::size_t{900}})
+        {
+            std::vector<std::uint8_t> dest(1100, 0xff);
+            copy(span<const std::uint8_t>(src).first(count),
+                 span<std::uint8_t>(dest).subspan(offset), policy);
+            for (std::size_t i = 0; i < dest.size(); ++i)
+            {
+                const bool copied = i >= offset && i < offset + count;
+                ASSERT_EQ(dest[i], copied ? src[i - offset] : 0xff)
+                    << "offset " << offset << ", count " << count << ", index " << i;
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(large_copy_tests, default_policy)
+{
+    std::array<std::uint32_t, 5> src{1, 2, 3, 4, 5};
+    std::array<std::uint32_t, 5> dest{};
+    copy(span<const std::uint32_t, 5>(src), span<std::uint32_t, 5>(dest), large_copy_policy{});
+    EXPECT_EQ(dest, src);
+
+    check_all_offsets(large_copy_policy{});
+}
+
+TEST(large_copy_tests, streaming)
+{
+    large_copy_policy policy;
+    policy.streaming_threshold = 0;
+    check_all_offsets(policy);
+}
+
+TEST(large_copy_tests, parallel)
+{
+    large_copy_policy policy;
+    policy.parallel_threshold = 0;
+    for (const unsigned threads : {2u, 3u, 7u, 64u})
+    {
+        policy.max_threads = threads;
+        policy.streaming_threshold = 0;
+        check_all_offsets(policy);
+        policy.streaming_threshold = static_cast<std::size_t>(-1);
+        check_all_offsets(policy);
+    }
+
+    policy.max_threads = 0;
+    std::vector<double> src(100000, 2.5);
+    std::vector<double> dest(100000);
+    copy(span<const double>(src), span<double>(dest), policy);
+    EXPECT_EQ(dest, src);
+}
+
+TEST(large_copy_tests, elements_that_are_not_trivially_copyable)
+{
+    large_copy_policy policy;
+    policy.streaming_threshold = 0;
+    policy.parallel_threshold = 0;
+    policy.max_threads = 4;
+
+    const std::array<std::string, 3> src{"a", "b", "c"};
+    std::array<std::string, 4> dest{};
+    copy(span<const std::string>(src), span<std::string>(dest), policy);
+    EXPECT_EQ(dest[2], "c");
+    EXPECT_EQ(dest[3], "");
+}
+
+TEST(large_copy_tests, small_destination_span)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. large_copy_small_destination_span";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::array<int, 12> src{};
+    std::array<int, 4> dest{};
+    EXPECT_DEATH(copy(span<int>(src), span<int>(dest), large_copy_policy{}), expected);
+}
+
+TEST(large_copy_tests, overlapping_spans)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. large_copy_overlapping_spans";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    std::array<int, 12> buffer{};
+    const span<int> s{buffer};
+    EXPECT_DEATH(copy(s.first(8), s.subspan(4), large_copy_policy{}), expected);
+    EXPECT_DEATH(copy(s.subspan(2, 8), s.first(8), large_copy_policy{}), expected);
+
+    // only the part of dest that is written must be disjoint
+    copy(s.subspan(6, 3), s.first(10), large_copy_policy{});
+    copy(s.first(6), s.subspan(6), large_copy_policy{});
+}
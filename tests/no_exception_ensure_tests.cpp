@@ -15,6 +15,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <cstdlib>  // for std::exit
+#include <gsl/gsl>  // checks that the umbrella header compiles without exceptions
 #include <gsl/span> // for span
 #include <iostream>
 
@@ -25,6 +26,14 @@ int operator_subscript_no_throw() noexcept
     return sp[11];
 }
 
+// the containers construct their elements without try blocks
+int construct_without_exceptions()
+{
+    const gsl::dyn_array<int> array(3, 1);
+    const auto buffer = gsl::make_shared_span<int>(2);
+    return array[2] + static_cast<int>(buffer.size());
+}
+
 [[noreturn]] void test_terminate() { std::exit(0); }
 
 void setup_termination_handler() noexcept
@@ -45,6 +54,7 @@ int main() noexcept
 {
     std::cout << "Running main() from " __FILE__ "\n";
     setup_termination_handler();
+    if (construct_without_exceptions() != 3) return -1;
     operator_subscript_no_throw();
     return -1;
 }
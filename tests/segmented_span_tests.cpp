@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/segmented_span> // for segmented_span, copy
+#include <gsl/span>           // for span
+
+#include <algorithm>   // for find, equal
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <iterator>    // for distance
+#include <numeric>     // for accumulate, iota
+#include <type_traits> // for is_nothrow_move_constructible
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+// four fragments, one of them empty: 0 1 2 | 3 | | 4 5 6 7
+struct fragmented_frame
+{
+    int a[3] = {0, 1, 2};
+    int b[1] = {3};
+    int d[4] = {4, 5, 6, 7};
+    std::array<span<int>, 4> segments{{span<int>(a), span<int>(b), span<int>(), span<int>(d)}};
+
+    segmented_span<int> view() { return {segments}; }
+};
+} // namespace
+
+TEST(segmented_span_tests, indexing)
+{
+    fragmented_frame frame;
+    const auto s = frame.view();
+
+    EXPECT_EQ(s.size(), 8u);
+    EXPECT_EQ(s.size_bytes(), 8 * sizeof(int));
+    EXPECT_FALSE(s.empty());
+    EXPECT_EQ(s.segments().size(), 4u);
+    for (std::size_t i = 0; i < s.size(); ++i) { EXPECT_EQ(s[i], static_cast<int>(i)); }
+
+    s[4] = 40;
+    EXPECT_EQ(frame.d[0], 40);
+    EXPECT_EQ(&s[3], &frame.b[0]);
+
+    const segmented_span<int> empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TEST(segmented_span_tests, iteration)
+{
+    fragmented_frame frame;
+    const auto s = frame.view();
+
+    std::vector<int> seen(s.begin(), s.end());
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(std::accumulate(s.begin(), s.end(), 0), 28);
+    EXPECT_EQ(*std::find(s.begin(), s.end(), 5), 5);
+
+    auto it = s.end();
+    --it;
+    EXPECT_EQ(*it, 7);
+    it -= 4;
+    EXPECT_EQ(*it, 3);
+    --it;
+    EXPECT_EQ(*it, 2);
+    ++it;
+    ++it;
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(it - s.begin(), 4);
+    EXPECT_EQ(s.begin()[6], 6);
+    EXPECT_TRUE(s.begin() < it);
+    EXPECT_EQ(std::distance(s.begin(), s.end()), 8);
+
+    std::vector<int> reversed;
+    for (auto r = s.end(); r != s.begin();) { reversed.push_back(*--r); }
+    EXPECT_EQ(reversed, (std::vector<int>{7, 6, 5, 4, 3, 2, 1, 0}));
+}
+
+TEST(segmented_span_tests, subspan)
+{
+    fragmented_frame frame;
+    const auto s = frame.view();
+
+    const auto middle = s.subspan(2, 4);
+    EXPECT_EQ(middle.size(), 4u);
+    EXPECT_EQ(middle[0], 2);
+    EXPECT_EQ(middle[3], 5);
+    EXPECT_EQ(std::vector<int>(middle.begin(), middle.end()), (std::vector<int>{2, 3, 4, 5}));
+
+    EXPECT_EQ(s.subspan(3).size(), 5u);
+    EXPECT_EQ(s.subspan(3)[0], 3);
+    EXPECT_EQ(s.subspan(4, 0).begin(), s.subspan(4, 0).end());
+    EXPECT_EQ(s.first(3)[2], 2);
+    EXPECT_EQ(s.last(2)[0], 6);
+    EXPECT_EQ(middle.subspan(1, 2)[1], 4);
+
+    std::vector<std::size_t> parts;
+    middle.for_each_segment([&](span<int> segment) { parts.push_back(segment.size()); });
+    EXPECT_EQ(parts, (std::vector<std::size_t>{1, 1, 2}));
+
+    // subspans carry the running totals of the view they come from
+    segmented_span<int> tail;
+    {
+        const segmented_span<int> whole{frame.segments};
+        tail = whole.subspan(3);
+    }
+    EXPECT_EQ(tail.size(), 5u);
+    EXPECT_EQ(tail[1], 4);
+    EXPECT_EQ(*(tail.begin() + 4), 7);
+}
+
+TEST(segmented_span_tests, long_chains)
+{
+    // more segments than the view keeps the running totals of, which are
+    // stored by the caller
+    std::vector<int> values(40);
+    std::iota(values.begin(), values.end(), 0);
+    std::vector<span<int>> segments;
+    for (std::size_t i = 0; i < values.size(); i += 4)
+    {
+        segments.emplace_back(&values[i], 4);
+        segments.emplace_back();
+    }
+
+    std::vector<std::size_t> totals(segments.size());
+    const segmented_span<int> s{segments, totals};
+    EXPECT_EQ(totals.back(), 40u);
+
+    EXPECT_EQ(s.size(), 40u);
+    for (std::size_t i = 0; i < s.size(); ++i) { EXPECT_EQ(s[i], static_cast<int>(i)); }
+    EXPECT_EQ(std::vector<int>(s.begin(), s.end()), values);
+    EXPECT_EQ(*(s.begin() + 37), 37);
+    EXPECT_EQ(*(s.end() - 30), 10);
+    EXPECT_EQ(s.subspan(13, 9)[8], 21);
+
+    std::size_t parts = 0;
+    s.subspan(6, 20).for_each_segment([&](span<int>) { ++parts; });
+    EXPECT_EQ(parts, 6u);
+
+    // the view keeps the totals of up to 8 segments itself
+    const segmented_span<int> inline_totals{span<const span<int>>(segments).first(8)};
+    EXPECT_EQ(inline_totals.size(), 16u);
+    EXPECT_EQ(inline_totals[15], 15);
+}
+
+TEST(segmented_span_tests, lifetime)
+{
+    fragmented_frame frame;
+
+    // the iterators of a temporary view only refer to the segments
+    const auto first = frame.view().subspan(2).begin();
+    const auto last = frame.view().subspan(2).end();
+    EXPECT_EQ(std::vector<int>(first, last), (std::vector<int>{2, 3, 4, 5, 6, 7}));
+
+    static_assert(std::is_nothrow_move_constructible<segmented_span<int>>::value, "");
+    auto s = frame.view();
+    const auto moved = std::move(s);
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(s.segments().size(), 0u);
+    EXPECT_EQ(s.begin(), s.end());
+    EXPECT_EQ(moved.size(), 8u);
+    EXPECT_EQ(moved[7], 7);
+
+    segmented_span<int> target;
+    auto source = moved.subspan(1, 3);
+    target = std::move(source);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(target.size(), 3u);
+    EXPECT_EQ(target[2], 3);
+}
+
+TEST(segmented_span_tests, copy)
+{
+    fragmented_frame frame;
+    const auto s = frame.view();
+
+    std::array<int, 10> out{};
+    copy(s, span<int>(out));
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), out.begin()));
+    EXPECT_EQ(out[8], 0);
+
+    std::array<long, 3> part{};
+    copy(s.subspan(2, 3), span<long, 3>(part));
+    EXPECT_EQ(part, (std::array<long, 3>{2, 3, 4}));
+}
+
+TEST(segmented_span_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. segmented_span_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    fragmented_frame frame;
+    const auto s = frame.view();
+    std::array<int, 7> small{};
+
+    EXPECT_DEATH(s[8], expected);
+    EXPECT_DEATH(s.subspan(2, 4)[4], expected);
+    EXPECT_DEATH(s.subspan(9), expected);
+    EXPECT_DEATH(s.subspan(4, 5), expected);
+    EXPECT_DEATH(s.last(9), expected);
+    EXPECT_DEATH(*s.end(), expected);
+    EXPECT_DEATH(++s.end(), expected);
+    EXPECT_DEATH(--s.begin(), expected);
+    EXPECT_DEATH(s.begin() + 9, expected);
+    EXPECT_DEATH(s.begin() == s.subspan(1).begin(), expected);
+    EXPECT_DEATH(copy(s, span<int>(small)), expected);
+
+    std::array<std::size_t, 3> totals{};
+    EXPECT_DEATH((segmented_span<int>{frame.segments, totals}), expected);
+
+    // chains longer than 8 segments need storage for their running totals
+    std::array<span<int>, 9> long_chain{};
+    EXPECT_DEATH((segmented_span<int>{long_chain}), expected);
+}
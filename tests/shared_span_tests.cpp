@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/shared_span> // for shared_span, make_shared_span
+#include <gsl/span>        // for span
+
+#include <cstddef>     // for size_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <memory>      // for shared_ptr
+#include <numeric>     // for accumulate, iota
+#include <stdexcept>   // for runtime_error
+#include <string>      // for string
+#include <thread>      // for thread
+#include <type_traits> // for is_copy_constructible
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+int sum(span<const int> s) { return std::accumulate(s.begin(), s.end(), 0); }
+
+struct counted
+{
+    static int alive;
+    static int throw_at;
+
+    counted()
+    {
+        if (alive == throw_at) throw std::runtime_error("construction failed");
+        ++alive;
+    }
+    counted(const counted&) : counted() {}
+    counted& operator=(const counted&) = default;
+    ~counted() { --alive; }
+};
+int counted::alive = 0;
+int counted::throw_at = -1;
+} // namespace
+
+static_assert(sizeof(shared_span<const int>) == sizeof(span<int>) + sizeof(void*),
+              "shared_span should store a span and a single pointer to its buffer");
+static_assert(!std::is_copy_constructible<shared_span<int>>::value,
+              "a writable shared_span must be the only owner of its buffer");
+static_assert(std::is_copy_constructible<shared_span<const int>>::value, "");
+static_assert(std::is_nothrow_move_constructible<shared_span<int>>::value, "");
+
+TEST(shared_span_tests, make_and_freeze)
+{
+    auto buffer = make_shared_span<int>(8);
+    EXPECT_EQ(buffer.size(), 8u);
+    EXPECT_EQ(buffer.size_bytes(), 8 * sizeof(int));
+    EXPECT_EQ(buffer.use_count(), 1u);
+    EXPECT_EQ(buffer[7], 0);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    EXPECT_EQ(sum(buffer), 28);
+
+    const int* const data = buffer.data();
+    const shared_span<const int> frozen = std::move(buffer).freeze();
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.use_count(), 0u);
+    EXPECT_EQ(frozen.data(), data);
+    EXPECT_EQ(frozen.use_count(), 1u);
+    EXPECT_EQ(frozen[3], 3);
+
+    const std::vector<std::string> words{"zero", "copy"};
+    const auto copied = make_shared_span(span<const std::string>(words));
+    EXPECT_EQ(copied.size(), 2u);
+    EXPECT_EQ(copied[1], "copy");
+    EXPECT_NE(copied.data(), words.data());
+
+    const shared_span<const int> empty{};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_EQ(make_shared_span<int>(0).size(), 0u);
+}
+
+TEST(shared_span_tests, slicing_shares_the_buffer)
+{
+    auto buffer = make_shared_span<int>(10);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto frozen = std::move(buffer).freeze();
+
+    const auto header = frozen.first(2);
+    const auto payload = frozen.subspan(2, 6);
+    const auto trailer = frozen.last(2);
+    EXPECT_EQ(frozen.use_count(), 4u);
+    EXPECT_EQ(payload.data(), frozen.data() + 2);
+    EXPECT_EQ(sum(payload), 2 + 3 + 4 + 5 + 6 + 7);
+    EXPECT_EQ(trailer[1], 9);
+    EXPECT_EQ(header.size(), 2u);
+
+    {
+        shared_span<const int> copy = payload;
+        EXPECT_EQ(frozen.use_count(), 5u);
+        const auto moved = std::move(copy).subspan(1);
+        EXPECT_EQ(frozen.use_count(), 5u);
+        EXPECT_EQ(moved[0], 3);
+    }
+    EXPECT_EQ(frozen.use_count(), 4u);
+
+    // the slices keep the buffer alive on their own
+    shared_span<const int> survivor;
+    {
+        auto temp = make_shared_span<int>(3);
+        temp[2] = 42;
+        survivor = std::move(temp).freeze().last(1);
+    }
+    EXPECT_EQ(survivor.use_count(), 1u);
+    EXPECT_EQ(survivor[0], 42);
+
+    auto writable = make_shared_span<int>(4);
+    writable[1] = 7;
+    const auto tail = std::move(writable).subspan(1);
+    EXPECT_TRUE(writable.empty());
+    EXPECT_EQ(tail.size(), 3u);
+    EXPECT_EQ(tail[0], 7);
+}
+
+TEST(shared_span_tests, moved_from_is_empty)
+{
+    auto buffer = make_shared_span<int>(4);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const int* const data = buffer.data();
+
+    auto owner = std::move(buffer);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.size(), 0u);
+    EXPECT_EQ(buffer.data(), nullptr);
+    EXPECT_EQ(buffer.use_count(), 0u);
+    EXPECT_EQ(owner.data(), data);
+    EXPECT_EQ(owner.use_count(), 1u);
+
+    auto other = make_shared_span<int>(2);
+    other = std::move(owner);
+    EXPECT_TRUE(owner.empty());
+    EXPECT_EQ(owner.data(), nullptr);
+    EXPECT_EQ(other.data(), data);
+    EXPECT_EQ(other[3], 3);
+
+    auto frozen = std::move(other).freeze();
+    shared_span<const int> copy = frozen;
+    const auto moved = std::move(frozen);
+    EXPECT_TRUE(frozen.empty());
+    EXPECT_EQ(frozen.use_count(), 0u);
+    EXPECT_EQ(moved.use_count(), 2u);
+    EXPECT_EQ(copy.data(), moved.data());
+
+    shared_span<const int> target;
+    target = std::move(copy);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(target.use_count(), 2u);
+}
+
+TEST(shared_span_tests, fan_out_to_threads)
+{
+    auto buffer = make_shared_span<int>(1000);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto frozen = std::move(buffer).freeze();
+
+    std::vector<int> sums(4);
+    std::vector<std::thread> consumers;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        consumers.emplace_back([slice = frozen.subspan(i * 250, 250), &sums, i] {
+            for (int k = 0; k < 100; ++k)
+            {
+                const shared_span<const int> copy = slice;
+                sums[i] = sum(copy);
+            }
+        });
+    }
+    for (auto& t : consumers) t.join();
+    EXPECT_EQ(sums[0] + sums[1] + sums[2] + sums[3], 999 * 1000 / 2);
+    EXPECT_EQ(frozen.use_count(), 1u);
+}
+
+TEST(shared_span_tests, element_lifetime)
+{
+    counted::alive = 0;
+    {
+        auto buffer = make_shared_span<counted>(5);
+        EXPECT_EQ(counted::alive, 5);
+        const auto frozen = std::move(buffer).freeze();
+        const auto slice = frozen.subspan(1, 1);
+        EXPECT_EQ(counted::alive, 5);
+    }
+    EXPECT_EQ(counted::alive, 0);
+
+    counted::throw_at = 3;
+    EXPECT_THROW(make_shared_span<counted>(5), std::runtime_error);
+    EXPECT_EQ(counted::alive, 0);
+    counted::throw_at = -1;
+}
+
+TEST(shared_span_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. shared_span_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const auto frozen = make_shared_span<int>(4).freeze();
+    EXPECT_DEATH(frozen[4], expected);
+    EXPECT_DEATH(frozen.subspan(5), expected);
+    EXPECT_DEATH(frozen.first(5), expected);
+    EXPECT_DEATH(make_shared_span<int>(static_cast<std::size_t>(-1) / 2), expected);
+}
@@ -19,10 +19,12 @@
 #include <gsl/span> // for span and span_ext
 #include <gsl/util> // for narrow_cast, at
 
-#include <array>     // for array
-#include <exception> // for terminate
-#include <iostream>  // for cerr
-#include <vector>    // for vector
+#include <array>       // for array
+#include <cstdint>     // for int16_t, uint32_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <type_traits> // for true_type
+#include <vector>      // for vector
 
 using namespace std;
 using namespace gsl;
@@ -377,4 +379,109 @@ TEST(span_ext_test, comparison_operators)
         EXPECT_FALSE(s1 >= s2);
     }
 }
+
+namespace
+{
+// all odd values are the same colour
+enum class colour : int
+{
+    red = 0,
+    blue = 1,
+    also_blue = 3
+};
+bool operator==(colour a, colour b)
+{
+    return (static_cast<int>(a) & 1) == (static_cast<int>(b) & 1);
+}
+
+enum class tag : std::uint32_t
+{
+    none,
+    some
+};
+} // namespace
+
+namespace gsl
+{
+template <>
+struct enable_bytewise_equal<tag> : std::true_type
+{
+};
+} // namespace gsl
+
+static_assert(!details::is_memcmp_equal<colour, colour>::value,
+              "enumerations may have their own operator==");
+static_assert(details::is_memcmp_equal<tag, const tag>::value, "");
+static_assert(details::is_memcmp_equal<gsl::byte, gsl::byte>::value, "");
+
+TEST(span_ext_test, comparison_operators_fast_paths)
+{
+    // the operator== of an enumeration is used unless it opts in
+    {
+        colour arr1[] = {colour::red, colour::blue};
+        colour arr2[] = {colour::red, colour::also_blue};
+        EXPECT_TRUE(gsl::span<colour>(arr1) == gsl::span<colour>(arr2));
+
+        tag tags1[] = {tag::none, tag::some};
+        tag tags2[] = {tag::none, tag::some};
+        EXPECT_TRUE(gsl::span<tag>(tags1) == gsl::span<tag>(tags2));
+        tags2[1] = tag::none;
+        EXPECT_FALSE(gsl::span<tag>(tags1) == gsl::span<tag>(tags2));
+    }
+
+    // longer than a block of the vectorized comparison
+    {
+        std::vector<std::uint32_t> v1(100);
+        for (std::size_t i = 0; i < v1.size(); ++i) v1[i] = static_cast<std::uint32_t>(i);
+        std::vector<std::uint32_t> v2 = v1;
+        const gsl::span<std::uint32_t> s1 = v1;
+        const gsl::span<std::uint32_t> s2 = v2;
+
+        EXPECT_TRUE(s1 == s2);
+        EXPECT_FALSE(s1 < s2);
+        v2[70] = 0xffffffff;
+        EXPECT_FALSE(s1 == s2);
+        EXPECT_TRUE(s1 < s2);
+        EXPECT_FALSE(s2 < s1);
+        v1[99] = 0xffffffff;
+        EXPECT_TRUE(s1 < s2);
+        EXPECT_TRUE(s1.first(70) == s2.first(70));
+        EXPECT_TRUE(s1.first(70) < s2);
+    }
+
+    // bytes order as unsigned, whatever their position
+    {
+        unsigned char arr1[] = {1, 2, 200};
+        unsigned char arr2[] = {1, 2, 3, 4};
+        const gsl::span<unsigned char> s1 = arr1;
+        const gsl::span<unsigned char> s2 = arr2;
+
+        EXPECT_TRUE(s2 < s1);
+        EXPECT_FALSE(s1 < s2);
+        EXPECT_TRUE(s2.first(2) < s1);
+    }
+
+    // signed elements are not compared bytewise
+    {
+        std::int16_t arr1[] = {-1, 5};
+        std::int16_t arr2[] = {1, 5};
+        const gsl::span<std::int16_t> s1 = arr1;
+        const gsl::span<std::int16_t> s2 = arr2;
+
+        EXPECT_TRUE(s1 < s2);
+        EXPECT_FALSE(s1 == s2);
+    }
+
+    // floating-point elements are compared by value
+    {
+        double arr1[] = {0.0, 1.0};
+        double arr2[] = {-0.0, 1.0};
+        const gsl::span<double> s1 = arr1;
+        const gsl::span<double> s2 = arr2;
+
+        EXPECT_TRUE(s1 == s2);
+        EXPECT_FALSE(s1 < s2);
+        EXPECT_FALSE(s2 < s1);
+    }
+}
 #endif // GSL_KERNEL_MODE
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/byte>      // for byte
+#include <gsl/span>      // for span
+#include <gsl/span_hash> // for content_hash, enable_bytewise_hash, span_hash, span_equal
+
+#include <cstddef>       // for size_t
+#include <cstdint>       // for int32_t, uint16_t
+#include <functional>    // for hash
+#include <string>        // for string
+#include <type_traits>   // for is_default_constructible, true_type
+#include <unordered_map> // for unordered_map
+#include <unordered_set> // for unordered_set
+#include <vector>        // for vector
+
+using namespace gsl;
+
+static_assert(std::is_default_constructible<std::hash<span<const int>>>::value,
+              "spans of integers should be hashable");
+static_assert(!std::is_default_constructible<std::hash<span<const double>>>::value,
+              "spans of floating-point values should not be hashable");
+
+namespace
+{
+// equal values have equal bytes, but only the types that say so are hashed bytewise
+struct point
+{
+    std::int32_t x;
+    std::int32_t y;
+};
+
+struct opted_in_point
+{
+    std::int32_t x;
+    std::int32_t y;
+};
+
+bool operator==(const opted_in_point& lhs, const opted_in_point& rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+} // namespace
+
+namespace gsl
+{
+template <>
+struct enable_bytewise_hash<opted_in_point> : std::true_type
+{
+};
+} // namespace gsl
+
+static_assert(std::is_default_constructible<std::hash<span<const gsl::byte>>>::value,
+              "spans of bytes should be hashable");
+static_assert(!std::is_default_constructible<std::hash<span<const point>>>::value,
+              "spans of structs should not be hashable unless they opt in");
+static_assert(std::is_default_constructible<std::hash<span<const opted_in_point>>>::value,
+              "spans of structs that opt in should be hashable");
+
+TEST(span_hash_tests, content_hash)
+{
+    const std::string text = "the quick brown fox jumps over the lazy dog";
+    const std::vector<char> copy(text.begin(), text.end());
+
+    // equal contents hash equal, wherever they are stored
+    EXPECT_EQ(content_hash(span<const char>(text)), content_hash(span<const char>(copy)));
+    EXPECT_EQ(content_hash(span<const char>(text).first<8>()),
+              content_hash(span<const char>(copy).first(8)));
+
+    // every length up to past the 32-byte blocks
+    std::unordered_set<std::size_t> hashes;
+    for (std::size_t n = 0; n <= text.size(); ++n)
+        hashes.insert(content_hash(span<const char>(text).first(n)));
+    EXPECT_EQ(hashes.size(), text.size() + 1);
+
+    // every byte changes the hash
+    std::vector<char> changed = copy;
+    for (std::size_t i = 0; i < changed.size(); ++i)
+    {
+        changed[i] = static_cast<char>(changed[i] ^ 1);
+        EXPECT_NE(content_hash(span<const char>(changed)), content_hash(span<const char>(copy)));
+        changed[i] = copy[i];
+    }
+
+    const std::uint16_t words[] = {1, 2, 3};
+    EXPECT_EQ(std::hash<span<const std::uint16_t>>{}(words),
+              content_hash(span<const std::uint16_t, 3>(words)));
+
+    const opted_in_point points[] = {{1, 2}, {3, 4}};
+    const opted_in_point same[] = {{1, 2}, {3, 4}};
+    EXPECT_TRUE(span<const opted_in_point>(points) == span<const opted_in_point>(same));
+    EXPECT_EQ(content_hash(span<const opted_in_point>(points)),
+              content_hash(span<const opted_in_point>(same)));
+}
+
+TEST(span_hash_tests, transparent_functors)
+{
+    std::unordered_map<std::string, int, span_hash<char>, span_equal<char>> ids;
+    ids["alpha"] = 1;
+    ids["beta"] = 2;
+
+    const std::string received = "xxbetaxx";
+    const span<const char> key = span<const char>(received).subspan(2, 4);
+    EXPECT_TRUE(span_equal<char>{}(key, std::string("beta")));
+    EXPECT_FALSE(span_equal<char>{}(key, std::string("alpha")));
+    EXPECT_EQ(span_hash<char>{}(key), span_hash<char>{}(std::string("beta")));
+
+    // string literals and null-terminated strings are keys without their null character
+    const char* const name = received.c_str() + 2;
+    EXPECT_TRUE(span_equal<char>{}("beta", std::string("beta")));
+    EXPECT_TRUE(span_equal<char>{}(key, "beta"));
+    EXPECT_FALSE(span_equal<char>{}(name, "beta"));
+    EXPECT_TRUE(span_equal<char>{}(name, "betaxx"));
+    EXPECT_EQ(span_hash<char>{}("beta"), span_hash<char>{}(std::string("beta")));
+    EXPECT_EQ(span_hash<char>{}(name), span_hash<char>{}("betaxx"));
+
+#if defined(__cpp_lib_generic_unordered_lookup)
+    EXPECT_EQ(ids.count("beta"), 1u);
+    EXPECT_EQ(ids.count("gamma"), 0u);
+
+    // no std::string is built for the lookup
+    const auto found = ids.find(key);
+    ASSERT_NE(found, ids.end());
+    EXPECT_EQ(found->second, 2);
+    EXPECT_EQ(ids.count(span<const char>(received).first(2)), 0u);
+#endif
+
+    std::unordered_set<span<const int>> views;
+    const int a[] = {1, 2, 3};
+    const int b[] = {1, 2, 3};
+    views.insert(span<const int>(a));
+    EXPECT_EQ(views.count(span<const int>(b)), 1u);
+}
@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/span>    // for span
+#include <gsl/span_nd> // for span_nd, extents, layout_right, layout_left, layout_tiled, unchecked
+
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <limits>      // for numeric_limits
+#include <numeric>     // for iota
+#include <type_traits> // for is_same
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+constexpr extents<2, dynamic_extent, 4> mixed_extents(3);
+static_assert(mixed_extents.rank() == 3, "");
+static_assert(mixed_extents.rank_dynamic() == 1, "");
+static_assert(mixed_extents.extent(0) == 2, "");
+static_assert(mixed_extents.extent(1) == 3, "");
+static_assert(mixed_extents.size() == 24, "");
+static_assert(std::is_same<dextents<2>, extents<dynamic_extent, dynamic_extent>>::value, "");
+
+std::array<int, 24> make_buffer()
+{
+    std::array<int, 24> buffer{};
+    std::iota(buffer.begin(), buffer.end(), 0);
+    return buffer;
+}
+} // namespace
+
+TEST(span_nd_tests, extents)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. extents";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    const extents<3, dynamic_extent> dynamic_only(4);
+    const extents<3, dynamic_extent> all(3, 4);
+    EXPECT_TRUE(dynamic_only == all);
+    EXPECT_FALSE(dynamic_only != all);
+    EXPECT_TRUE(all == dextents<2>(3, 4));
+    EXPECT_FALSE(all == dextents<2>(4, 3));
+
+    const extents<3, 4> empty_dynamic{};
+    EXPECT_EQ(empty_dynamic.size(), 12u);
+
+    EXPECT_DEATH((extents<3, dynamic_extent>(2, 4)), expected);
+    EXPECT_DEATH(all.extent(2), expected);
+}
+
+TEST(span_nd_tests, layout_right)
+{
+    auto buffer = make_buffer();
+    const span_nd<int, dextents<2>> m(buffer, 4, 6);
+
+    EXPECT_EQ(m.rank(), 2u);
+    EXPECT_EQ(m.extent(0), 4u);
+    EXPECT_EQ(m.extent(1), 6u);
+    EXPECT_EQ(m.size(), 24u);
+    EXPECT_FALSE(m.empty());
+    EXPECT_EQ(m.data(), buffer.data());
+    EXPECT_EQ(m.mapping().stride(0), 6u);
+    EXPECT_EQ(m.mapping().stride(1), 1u);
+
+    EXPECT_EQ(m(0, 0), 0);
+    EXPECT_EQ(m(1, 2), 8);
+    EXPECT_EQ(m(3, 5), 23);
+
+    m(2, 1) = 100;
+    EXPECT_EQ(buffer[13], 100);
+
+    const auto row = m.row(2);
+    static_assert(std::is_same<decltype(row), const span<int>>::value, "");
+    EXPECT_EQ(row.size(), 6u);
+    EXPECT_EQ(row[0], 12);
+    EXPECT_EQ(row[1], 100);
+}
+
+TEST(span_nd_tests, layout_left)
+{
+    auto buffer = make_buffer();
+    const span_nd<int, extents<4, 6>, layout_left> m(buffer);
+
+    EXPECT_EQ(m.mapping().stride(0), 1u);
+    EXPECT_EQ(m.mapping().stride(1), 4u);
+    EXPECT_EQ(m(1, 2), 9);
+    EXPECT_EQ(m(3, 5), 23);
+
+    const auto column = m.column(2);
+    static_assert(std::is_same<decltype(column), const span<int, 4>>::value, "");
+    EXPECT_EQ(column[0], 8);
+    EXPECT_EQ(column[3], 11);
+}
+
+TEST(span_nd_tests, layout_tiled)
+{
+    auto buffer = make_buffer();
+    // 4x6 matrix made of 2x3 tiles, tiles and the elements in them are row-major
+    const span_nd<int, dextents<2>, layout_tiled<2, 3>> m(buffer, 4, 6);
+
+    EXPECT_EQ(m(0, 0), 0);
+    EXPECT_EQ(m(0, 2), 2);
+    EXPECT_EQ(m(1, 0), 3);
+    EXPECT_EQ(m(0, 3), 6);
+    EXPECT_EQ(m(1, 5), 11);
+    EXPECT_EQ(m(2, 0), 12);
+    EXPECT_EQ(m(3, 5), 23);
+    EXPECT_EQ(m.mapping().required_span_size(), 24u);
+
+    const auto tile = m.subspan<0>(2, 2).subspan<1>(3, 3);
+    EXPECT_EQ(tile.size(), 6u);
+    EXPECT_EQ(tile(0, 0), 18);
+    EXPECT_EQ(tile(1, 2), 23);
+}
+
+TEST(span_nd_tests, subspan)
+{
+    auto buffer = make_buffer();
+    const span_nd<int, extents<2, 3, 4>> cube(buffer);
+
+    const auto sub = cube.subspan<1>(1, 2);
+    static_assert(std::is_same<decltype(sub)::extents_type, extents<2, dynamic_extent, 4>>::value,
+                  "subspan() should only make the sliced dimension dynamic");
+    EXPECT_EQ(sub.extent(1), 2u);
+    EXPECT_EQ(sub.size(), 16u);
+    EXPECT_EQ(sub(0, 0, 0), 4);
+    EXPECT_EQ(sub(1, 1, 3), 23);
+    EXPECT_EQ(sub.mapping().required_span_size(), 20u);
+
+    const auto inner = sub.subspan<2>(1, 2);
+    EXPECT_EQ(inner(0, 0, 0), 5);
+    EXPECT_EQ(inner(1, 1, 1), 22);
+
+    const auto empty = cube.subspan<0>(2, 0);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.mapping().required_span_size(), 0u);
+}
+
+TEST(span_nd_tests, unchecked)
+{
+    auto buffer = make_buffer();
+
+    // every element of every layout is reachable through the unchecked view
+    const span_nd<int, extents<2, 3, 4>> right(buffer);
+    const span_nd<int, dextents<3>, layout_left> left(buffer, 2, 3, 4);
+    const span_nd<int, dextents<2>, layout_tiled<2, 3>> tiled(buffer, 4, 6);
+    const auto r = unchecked(right);
+    const auto l = unchecked(left);
+    const auto t = unchecked(tiled);
+    static_assert(std::is_same<decltype(r), const unchecked_span_nd<int, extents<2, 3, 4>>>::value,
+                  "");
+    EXPECT_EQ(r.size(), 24u);
+    EXPECT_EQ(t.extent(1), 6u);
+    for (std::size_t i = 0; i < 2; ++i)
+        for (std::size_t j = 0; j < 3; ++j)
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                EXPECT_EQ(&r(i, j, k), &right(i, j, k));
+                EXPECT_EQ(&l(i, j, k), &left(i, j, k));
+            }
+    for (std::size_t i = 0; i < 4; ++i)
+        for (std::size_t j = 0; j < 6; ++j) EXPECT_EQ(&t(i, j), &tiled(i, j));
+
+    // slices are checked on the span_nd, then walked unchecked
+    const auto sub = unchecked(right.subspan<1>(1, 2).subspan<2>(1, 2));
+    EXPECT_EQ(sub(0, 0, 0), 5);
+    EXPECT_EQ(sub(1, 1, 1), 22);
+    const auto tile = unchecked(tiled.subspan<0>(2, 2).subspan<1>(3, 3));
+    tile(1, 2) = 100;
+    EXPECT_EQ(buffer[23], 100);
+}
+
+TEST(span_nd_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. span_nd_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    auto buffer = make_buffer();
+    const span<int> s{buffer};
+    const span_nd<int, dextents<2>> m(s, 4, 6);
+    const span_nd<int, dextents<2>, layout_tiled<2, 3>> tiled(s, 4, 6);
+
+    EXPECT_DEATH((span_nd<int, dextents<2>>(s, 5, 5)), expected);
+    EXPECT_DEATH((span_nd<int, dextents<2>, layout_tiled<2, 3>>(s, 3, 6)), expected);
+    EXPECT_DEATH(m(4, 0), expected);
+    EXPECT_DEATH(m(0, 6), expected);
+    EXPECT_DEATH(m(-1, 0), expected);
+    EXPECT_DEATH(m.row(4), expected);
+    EXPECT_DEATH(m.subspan<0>(3, 2), expected);
+    EXPECT_DEATH(m.subspan<1>(7, 0), expected);
+    EXPECT_DEATH(tiled.subspan<1>(1, 3), expected);
+}
+
+TEST(span_nd_tests, size_overflow)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. span_nd_size_overflow";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    // the product of two of these does not fit in a size_t
+    const std::size_t huge = std::size_t{1} << (std::numeric_limits<std::size_t>::digits / 2 + 1);
+    auto buffer = make_buffer();
+    const span<int> s{buffer};
+
+    EXPECT_DEATH((dextents<2>(huge, huge).size()), expected);
+    EXPECT_DEATH((extents<dynamic_extent, 4, dynamic_extent>(huge, huge).size()), expected);
+    EXPECT_DEATH((span_nd<int, dextents<2>>(s, huge, huge)), expected);
+    EXPECT_DEATH((span_nd<int, dextents<2>, layout_left>(s, huge, huge)), expected);
+    EXPECT_DEATH((span_nd<int, dextents<2>, layout_tiled<2, 3>>(s, huge, 3 * huge)), expected);
+
+    // empty spans never overflow, whatever their other extents
+    EXPECT_EQ((dextents<3>(huge, 0, huge).size()), 0u);
+    EXPECT_EQ((span_nd<int, dextents<2>>(s, 0, huge).size()), 0u);
+}
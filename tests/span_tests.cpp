@@ -48,6 +48,15 @@
 
 using namespace gsl;
 
+#if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+static_assert(std::contiguous_iterator<gsl::span<int>::iterator>,
+              "gsl::span should expose a contiguous_iterator");
+static_assert(std::contiguous_iterator<gsl::span<const int>::iterator>,
+              "gsl::span should expose a contiguous_iterator");
+static_assert(std::ranges::contiguous_range<gsl::span<int>>,
+              "gsl::span should be a contiguous range");
+#endif // __cpp_lib_ranges >= 201911L
+
 #if __cplusplus >= 201703l
 using std::void_t;
 #else  // __cplusplus >= 201703l
@@ -0,0 +1,409 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/span>       // for span
+#include <gsl/span_views> // for unchecked, zip, chunks, assume_disjoint...
+
+#include <algorithm>   // for sort
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <iterator>    // for next
+#include <memory>      // for pointer_traits
+#include <numeric>     // for iota
+#include <tuple>       // for get
+#include <type_traits> // for is_same
+#include <vector>      // for vector
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+static_assert(sizeof(unchecked_view<int, 4>) == sizeof(int*),
+              "a static extent unchecked_view should only store a pointer");
+static_assert(sizeof(unchecked_view<int>) == sizeof(span<int>),
+              "a dynamic extent unchecked_view should be as large as a span");
+static_assert(sizeof(unchecked_view<int>::iterator) == sizeof(int*),
+              "unchecked_view's iterator should only store a pointer");
+static_assert(std::is_trivially_copyable<unchecked_view<int>::iterator>::value,
+              "unchecked_view's iterator should be passed in a register");
+
+#if defined(__cpp_lib_ranges) && (__cpp_lib_ranges >= 201911L)
+static_assert(std::contiguous_iterator<unchecked_view<int>::iterator>,
+              "unchecked_view should expose a contiguous_iterator");
+static_assert(std::ranges::contiguous_range<unchecked_view<const int>>,
+              "unchecked_view should be a contiguous range");
+static_assert(std::ranges::random_access_range<chunk_view<int>>,
+              "chunks() should be a random-access range");
+static_assert(std::ranges::random_access_range<window_view<const int>>,
+              "windows() should be a random-access range");
+static_assert(std::ranges::random_access_range<block_view<float, 8>>,
+              "blocks() should be a random-access range");
+#endif // __cpp_lib_ranges >= 201911L
+
+TEST(span_views_tests, unchecked)
+{
+    std::vector<int> vec{1, 2, 3, 4, 5};
+
+    {
+        const auto view = unchecked(span<int>(vec));
+        EXPECT_EQ(view.size(), vec.size());
+        EXPECT_FALSE(view.empty());
+        EXPECT_EQ(view.data(), vec.data());
+        EXPECT_EQ(view.end() - view.begin(), 5);
+
+        int sum = 0;
+        for (int i : view) { sum += i; }
+        EXPECT_EQ(sum, 15);
+
+        for (int& i : view) { i *= 2; }
+        EXPECT_EQ(vec[4], 10);
+    }
+
+    {
+        std::array<int, 3> arr{1, 2, 3};
+        const auto view = unchecked(span<const int, 3>(arr));
+        EXPECT_EQ(view.size(), 3u);
+        EXPECT_EQ(*view.begin(), 1);
+        EXPECT_EQ(*(view.end() - 1), 3);
+    }
+
+    {
+        const auto view = unchecked(span<int>{});
+        EXPECT_TRUE(view.empty());
+        EXPECT_EQ(view.begin(), view.end());
+    }
+}
+
+TEST(span_views_tests, unchecked_iterator)
+{
+    int arr[] = {5, 4, 3, 2, 1};
+    const auto view = unchecked(span<int>(arr));
+
+    auto first = view.begin();
+    auto last = view.end();
+    EXPECT_EQ(last - first, 5);
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(last > first);
+    EXPECT_TRUE(first <= first);
+    EXPECT_TRUE(last >= first);
+    EXPECT_TRUE(first != last);
+    EXPECT_EQ(*(first + 1), 4);
+    EXPECT_EQ(*(1 + first), 4);
+    EXPECT_EQ(*(last - 1), 1);
+    EXPECT_EQ(first[2], 3);
+    EXPECT_EQ(std::pointer_traits<decltype(last)>::to_address(last), arr + 5);
+
+    unchecked_view<const int>::iterator cfirst = first;
+    EXPECT_TRUE(cfirst == first);
+    EXPECT_EQ(last - cfirst, 5);
+
+    auto it = first;
+    EXPECT_EQ(*it++, 5);
+    EXPECT_EQ(*it--, 4);
+    EXPECT_EQ(*++it, 4);
+    EXPECT_EQ(*--it, 5);
+    it += 3;
+    EXPECT_EQ(*it, 2);
+    it -= 2;
+    EXPECT_EQ(*it, 4);
+
+    std::sort(view.begin(), view.end());
+    EXPECT_EQ(arr[0], 1);
+    EXPECT_EQ(arr[4], 5);
+}
+
+TEST(span_views_tests, unchecked_from_subspan)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. unchecked_from_subspan";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    const span<int> s{arr};
+
+    // the checks happen at the boundary, when the subspan is created
+    const auto view = unchecked(s.subspan(2, 3));
+    EXPECT_EQ(view.size(), 3u);
+    EXPECT_EQ(*view.begin(), 3);
+
+    EXPECT_DEATH(unchecked(s.subspan(4, 3)), expected);
+}
+
+TEST(span_views_tests, chunks)
+{
+    std::vector<int> vec(10);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    const auto pieces = chunks(span<int>(vec), 4);
+    EXPECT_EQ(pieces.size(), 3u);
+    EXPECT_EQ(pieces.chunk_size(), 4u);
+    EXPECT_FALSE(pieces.empty());
+
+    EXPECT_EQ(pieces[0].data(), vec.data());
+    EXPECT_EQ(pieces[0].size(), 4u);
+    EXPECT_EQ(pieces[1].front(), 4);
+    EXPECT_EQ(pieces[2].size(), 2u);
+    EXPECT_EQ(pieces[2].back(), 9);
+
+    std::size_t count = 0;
+    int sum = 0;
+    for (span<int> chunk : pieces)
+    {
+        ++count;
+        for (int i : chunk) { sum += i; }
+    }
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(sum, 45);
+
+    const auto it = pieces.begin();
+    EXPECT_EQ(pieces.end() - it, 3);
+    EXPECT_EQ((*(it + 2)).size(), 2u);
+    EXPECT_EQ(it[1].front(), 4);
+    EXPECT_TRUE(it < pieces.end());
+
+    EXPECT_EQ(chunks(span<int>(vec), 5).size(), 2u);
+    EXPECT_EQ(chunks(span<int>(vec), 5)[1].size(), 5u);
+    EXPECT_EQ(chunks(span<int>(vec), 20).size(), 1u);
+    EXPECT_TRUE(chunks(span<int>{}, 3).empty());
+    EXPECT_EQ(chunks(span<int>{}, 3).begin(), chunks(span<int>{}, 3).end());
+}
+
+TEST(span_views_tests, windows)
+{
+    const int arr[] = {1, 2, 3, 4, 5};
+
+    const auto runs = windows(span<const int>(arr), 3);
+    EXPECT_EQ(runs.size(), 3u);
+    EXPECT_EQ(runs.window_size(), 3u);
+    EXPECT_EQ(runs[0].data(), arr);
+    EXPECT_EQ(runs[2].data(), arr + 2);
+
+    std::vector<int> sums;
+    for (span<const int> w : runs) { sums.push_back(w[0] + w[1] + w[2]); }
+    EXPECT_EQ(sums, (std::vector<int>{6, 9, 12}));
+
+    EXPECT_EQ(windows(span<const int>(arr), 5).size(), 1u);
+    EXPECT_TRUE(windows(span<const int>(arr), 6).empty());
+    EXPECT_EQ(std::next(runs.begin(), 3), runs.end());
+}
+
+TEST(span_views_tests, blocks)
+{
+    std::vector<int> vec(11);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    const auto full = blocks<4>(span<int>(vec));
+    static_assert(std::is_same<decltype(full[0]), span<int, 4>>::value,
+                  "blocks() should yield static extent spans");
+    static_assert(decltype(full)::block_size() == 4, "");
+    EXPECT_EQ(full.size(), 2u);
+    EXPECT_FALSE(full.empty());
+    EXPECT_EQ(full[1].data(), vec.data() + 4);
+    EXPECT_EQ(full.tail().size(), 3u);
+    EXPECT_EQ(full.tail().front(), 8);
+
+    int sums[4] = {};
+    for (span<int, 4> block : full)
+    {
+        for (std::size_t i = 0; i < block.size(); ++i) { sums[i] += block[i]; }
+    }
+    for (int i : full.tail()) { sums[0] += i; }
+    EXPECT_EQ(sums[0], 4 + 27);
+    EXPECT_EQ(sums[3], 10);
+
+    const auto exact = blocks<11>(span<const int>(vec));
+    EXPECT_EQ(exact.size(), 1u);
+    EXPECT_TRUE(exact.tail().empty());
+
+    const auto none = blocks<16>(span<int>(vec));
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.begin(), none.end());
+    EXPECT_EQ(none.tail().size(), 11u);
+
+    std::array<int, 8> arr{};
+    EXPECT_EQ(blocks<2>(span<int, 8>(arr)).size(), 4u);
+}
+
+TEST(span_views_tests, pieces_contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. pieces_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    const span<int> s{arr};
+    const auto pieces = chunks(s, 4);
+    const auto runs = windows(s, 4);
+
+    EXPECT_DEATH(chunks(s, 0), expected);
+    EXPECT_DEATH(windows(s, 0), expected);
+    EXPECT_DEATH(pieces[2], expected);
+    EXPECT_DEATH(runs[3], expected);
+    EXPECT_DEATH(*pieces.end(), expected);
+    EXPECT_DEATH(pieces.begin() + 3, expected);
+    EXPECT_DEATH(pieces.begin() == chunks(s, 3).begin(), expected);
+    EXPECT_DEATH(blocks<4>(s)[1], expected);
+}
+
+namespace
+{
+void scale(const float* GSL_RESTRICT in, float* GSL_RESTRICT out, std::size_t n, float k)
+{
+    for (std::size_t i = 0; i < n; ++i) { out[i] = in[i] * k; }
+}
+} // namespace
+
+TEST(span_views_tests, assume_disjoint)
+{
+    float input[] = {1, 2, 3, 4};
+    float output[4] = {};
+
+    const auto views = assume_disjoint(span<const float>(input), span<float>(output));
+    const auto in = std::get<0>(views);
+    const auto out = std::get<1>(views);
+    static_assert(std::is_same<decltype(in), const restrict_span<const float>>::value, "");
+    EXPECT_EQ(in.size(), 4u);
+    EXPECT_EQ(out.data(), output);
+    EXPECT_EQ(in[2], 3.0f);
+
+    scale(in.data(), out.data(), in.size(), 2.0f);
+    EXPECT_EQ(output[3], 8.0f);
+
+    float total = 0;
+    for (float f : out) { total += f; }
+    EXPECT_EQ(total, 20.0f);
+    EXPECT_EQ(out.as_span().size(), 4u);
+
+    // adjacent ranges and overlapping read-only ranges are fine
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    const span<int> s{arr};
+    EXPECT_EQ(std::get<2>(assume_disjoint(s.first(2), s.subspan(2, 2), s.last(2))).size(), 2u);
+    EXPECT_EQ(std::get<1>(assume_disjoint(span<const int>(s), span<const int>(s))).size(), 6u);
+    EXPECT_TRUE(std::get<1>(assume_disjoint(s, s.subspan(3, 0))).empty());
+}
+
+TEST(span_views_tests, copy_disjoint)
+{
+    int src[] = {1, 2, 3, 4, 5};
+    int dst[6] = {};
+    const auto views = assume_disjoint(span<const int, 5>(src), span<int>(dst));
+    copy(std::get<0>(views), std::get<1>(views));
+    EXPECT_EQ(dst[0], 1);
+    EXPECT_EQ(dst[4], 5);
+    EXPECT_EQ(dst[5], 0);
+
+    std::vector<std::vector<int>> from{{1}, {2, 3}};
+    std::vector<std::vector<int>> to(2);
+    const auto nested =
+        assume_disjoint(span<const std::vector<int>>(from), span<std::vector<int>>(to));
+    copy(std::get<0>(nested), std::get<1>(nested));
+    EXPECT_EQ(to[1].size(), 2u);
+}
+
+TEST(span_views_tests, disjoint_contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. disjoint_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int arr[] = {1, 2, 3, 4, 5, 6};
+    const span<int> s{arr};
+
+    EXPECT_DEATH(assume_disjoint(s.first(3), s.subspan(2)), expected);
+    EXPECT_DEATH(assume_disjoint(span<const int>(s.first(3)), s.subspan(2)), expected);
+    EXPECT_DEATH(assume_disjoint(s.first(2), s.subspan(2, 2), s.subspan(1, 2)), expected);
+
+    const auto views = assume_disjoint(s.first(4), s.last(2));
+    EXPECT_DEATH(std::get<1>(views)[2], expected);
+    EXPECT_DEATH(copy(std::get<0>(views), std::get<1>(views)), expected);
+}
+
+TEST(span_views_tests, zip)
+{
+    const float a[] = {1, 2, 3, 4};
+    std::vector<float> b{5, 6, 7, 8};
+    float out[4] = {};
+
+    const auto view = zip(span<const float>(a), span<const float>(b), span<float>(out));
+    EXPECT_EQ(view.size(), 4u);
+    EXPECT_FALSE(view.empty());
+    EXPECT_EQ(view.end() - view.begin(), 4);
+
+    for (auto elems : view) { std::get<2>(elems) = std::get<0>(elems) * std::get<1>(elems); }
+    EXPECT_EQ(out[0], 5.0f);
+    EXPECT_EQ(out[3], 32.0f);
+
+    const auto it = view.begin() + 2;
+    EXPECT_EQ(&std::get<1>(*it), &b[2]);
+    EXPECT_EQ(&std::get<2>(it[1]), &out[3]);
+    static_assert(
+        std::is_same<decltype(*it), std::tuple<const float&, const float&, float&>>::value,
+        "zip() should yield references");
+
+    std::array<int, 3> x{1, 2, 3};
+    std::array<int, 3> y{};
+    for (auto elems : zip(span<int, 3>(x), span<int>(y)))
+    {
+        std::get<1>(elems) = std::get<0>(elems);
+    }
+    EXPECT_EQ(y, x);
+
+    EXPECT_TRUE(zip(span<int>{}, span<const float>{}).empty());
+}
+
+TEST(span_views_tests, enumerate)
+{
+    std::vector<int> vec{10, 20, 30};
+
+    std::size_t expected_index = 0;
+    for (auto elem : enumerate(span<int>(vec)))
+    {
+        EXPECT_EQ(elem.first, expected_index++);
+        elem.second += static_cast<int>(elem.first);
+    }
+    EXPECT_EQ(expected_index, 3u);
+    EXPECT_EQ(vec[2], 32);
+
+    const auto view = enumerate(span<const int>(vec));
+    EXPECT_EQ(view.size(), 3u);
+    EXPECT_EQ((*(view.begin() + 1)).second, 21);
+    EXPECT_EQ(view.begin()[2].first, 2u);
+    EXPECT_TRUE(enumerate(span<int>{}).empty());
+}
+
+TEST(span_views_tests, zip_contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. zip_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    int a[] = {1, 2, 3};
+    int b[] = {1, 2};
+    EXPECT_DEATH(zip(span<int>(a), span<int>(b)), expected);
+    EXPECT_DEATH(zip(span<int>(b), span<int>(b), span<int, 3>(a)), expected);
+}
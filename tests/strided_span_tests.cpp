@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2026 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <gsl/span>         // for span
+#include <gsl/strided_span> // for strided_span, strided, column
+
+#include <algorithm>   // for max_element, sort
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t, uint32_t
+#include <exception>   // for terminate
+#include <iostream>    // for cerr
+#include <iterator>    // for distance
+#include <limits>      // for numeric_limits
+#include <numeric>     // for accumulate
+#include <type_traits> // for is_same
+
+#include "deathTestCommon.h"
+
+using namespace gsl;
+
+namespace
+{
+struct telemetry_record
+{
+    std::uint64_t timestamp;
+    double value;
+    std::uint32_t sensor;
+    std::uint32_t flags;
+    char payload[40];
+};
+static_assert(sizeof(telemetry_record) == 64, "");
+
+std::array<telemetry_record, 8> make_records()
+{
+    std::array<telemetry_record, 8> records{};
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        records[i].timestamp = 1000 + i;
+        records[i].value = static_cast<double>(i) * 0.5;
+        records[i].sensor = static_cast<std::uint32_t>(7 - i);
+    }
+    return records;
+}
+} // namespace
+
+static_assert(sizeof(strided_span<int, 64>) == sizeof(span<int>),
+              "a static stride should take no space in a strided_span");
+static_assert(sizeof(strided_span<int>) == sizeof(span<int>) + sizeof(std::size_t),
+              "a dynamic stride should be stored next to the pointer and the size");
+static_assert(std::is_convertible<strided_span<int, 64>, strided_span<const int>>::value, "");
+static_assert(!std::is_convertible<strided_span<const int, 64>, strided_span<int, 64>>::value,
+              "");
+static_assert(!std::is_convertible<strided_span<int>, strided_span<int, 64>>::value, "");
+
+TEST(strided_span_tests, column)
+{
+    auto records = make_records();
+
+    const auto values = column(span<telemetry_record>(records), &telemetry_record::value);
+    static_assert(std::is_same<decltype(values), const strided_span<double, 64>>::value, "");
+    EXPECT_EQ(values.size(), records.size());
+    EXPECT_EQ(values.stride(), sizeof(telemetry_record));
+    EXPECT_EQ(values.data(), &records[0].value);
+    EXPECT_EQ(values[3], 1.5);
+    EXPECT_EQ(&values.back(), &records[7].value);
+
+    values[2] = 42.0;
+    EXPECT_EQ(records[2].value, 42.0);
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0.0), 55.0);
+
+    const span<const telemetry_record> view{records};
+    const auto sensors = column(view, &telemetry_record::sensor);
+    static_assert(std::is_same<decltype(sensors)::element_type, const std::uint32_t>::value,
+                  "column() over a span of const should yield const elements");
+    EXPECT_EQ(*std::max_element(sensors.begin(), sensors.end()), 7u);
+    EXPECT_EQ(sensors.front(), 7u);
+
+    const auto none = column(span<telemetry_record>{}, &telemetry_record::timestamp);
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.begin(), none.end());
+}
+
+TEST(strided_span_tests, strided)
+{
+    int arr[] = {0, 1, 2, 3, 4, 5, 6};
+
+    const auto evens = strided(span<int>(arr), 2);
+    EXPECT_EQ(evens.size(), 4u);
+    EXPECT_EQ(evens.stride(), 2 * sizeof(int));
+    EXPECT_EQ(evens[3], 6);
+
+    const auto every_third = strided(span<int>(arr), 3);
+    EXPECT_EQ(every_third.size(), 3u);
+    EXPECT_EQ(every_third.back(), 6);
+
+    const auto all = strided(span<int>(arr), 1);
+    EXPECT_EQ(all.size(), 7u);
+
+    // the count is rounded up without overflowing, whatever the size
+    const std::size_t max_size = std::numeric_limits<std::size_t>::max() - 1;
+    const span<const char> huge{"", max_size};
+    EXPECT_EQ(strided(huge, 3).size(), max_size / 3 + 1);
+    EXPECT_EQ(strided(huge, max_size).size(), 1u);
+
+    // so is the stride of a single element
+    const span<const int> huge_ints{arr, max_size};
+    EXPECT_EQ(strided(huge_ints, max_size).size(), 1u);
+    EXPECT_EQ(strided(huge_ints, max_size).stride(), sizeof(int));
+
+    const strided_span<const int> cevens = evens;
+    EXPECT_EQ(cevens[1], 2);
+
+    const strided_span<int> runtime_stride(arr, 3, 3 * sizeof(int));
+    EXPECT_EQ(runtime_stride[2], 6);
+}
+
+TEST(strided_span_tests, subspan)
+{
+    auto records = make_records();
+    const auto stamps = column(span<telemetry_record>(records), &telemetry_record::timestamp);
+
+    const auto middle = stamps.subspan(2, 3);
+    static_assert(std::is_same<decltype(middle), decltype(stamps)>::value,
+                  "subspan() should keep the static stride");
+    EXPECT_EQ(middle.size(), 3u);
+    EXPECT_EQ(middle[0], 1002u);
+    EXPECT_EQ(middle.back(), 1004u);
+
+    EXPECT_EQ(stamps.subspan(5).size(), 3u);
+    EXPECT_EQ(stamps.subspan(8).size(), 0u);
+    EXPECT_EQ(stamps.first(2).back(), 1001u);
+    EXPECT_EQ(stamps.last(2).front(), 1006u);
+}
+
+TEST(strided_span_tests, iterator)
+{
+    int arr[] = {8, 1, 6, 3, 4, 5, 2, 7};
+    const auto evens = strided(span<int>(arr), 2);
+
+    auto first = evens.begin();
+    auto last = evens.end();
+    EXPECT_EQ(last - first, 4);
+    EXPECT_EQ(std::distance(first, last), 4);
+    EXPECT_TRUE(first < last);
+    EXPECT_TRUE(last > first);
+    EXPECT_TRUE(first <= first);
+    EXPECT_TRUE(last >= first);
+    EXPECT_TRUE(first != last);
+    EXPECT_EQ(*(first + 1), 6);
+    EXPECT_EQ(*(1 + first), 6);
+    EXPECT_EQ(*(last - 1), 2);
+    EXPECT_EQ(first[2], 4);
+
+    strided_span<const int>::iterator cfirst = first;
+    EXPECT_TRUE(cfirst == first);
+    EXPECT_EQ(last - cfirst, 4);
+
+    auto it = first;
+    EXPECT_EQ(*it++, 8);
+    EXPECT_EQ(*it--, 6);
+    EXPECT_EQ(*++it, 6);
+    EXPECT_EQ(*--it, 8);
+    it += 3;
+    EXPECT_EQ(*it, 2);
+    it -= 2;
+    EXPECT_EQ(*it, 6);
+
+    std::sort(evens.begin(), evens.end());
+    EXPECT_EQ(arr[0], 2);
+    EXPECT_EQ(arr[2], 4);
+    EXPECT_EQ(arr[4], 6);
+    EXPECT_EQ(arr[6], 8);
+    EXPECT_EQ(arr[1], 1);
+    EXPECT_EQ(*evens.rbegin(), 8);
+}
+
+TEST(strided_span_tests, contract_violations)
+{
+    const auto terminateHandler = std::set_terminate([] {
+        std::cerr << "Expected Death. strided_span_contract_violations";
+        std::abort();
+    });
+    const auto expected = GetExpectedDeathString(terminateHandler);
+
+    auto records = make_records();
+    const auto values = column(span<telemetry_record>(records), &telemetry_record::value);
+    int arr[] = {1, 2, 3, 4};
+    const auto evens = strided(span<int>(arr), 2);
+    const auto odds = strided(span<int>(arr).subspan(1), 2);
+
+    EXPECT_DEATH(values[8], expected);
+    EXPECT_DEATH(values.subspan(9), expected);
+    EXPECT_DEATH(values.subspan(4, 5), expected);
+    EXPECT_DEATH(values.first(9), expected);
+    EXPECT_DEATH(values.subspan(8).front(), expected);
+    EXPECT_DEATH(*values.end(), expected);
+    EXPECT_DEATH(++values.end(), expected);
+    EXPECT_DEATH(--values.begin(), expected);
+    EXPECT_DEATH(values.begin() + 9, expected);
+    EXPECT_DEATH(evens.begin() == odds.begin(), expected);
+    EXPECT_DEATH(strided(span<int>(arr), 0), expected);
+    const span<const int> huge_ints{arr, std::numeric_limits<std::size_t>::max() - 1};
+    EXPECT_DEATH(strided(huge_ints, std::numeric_limits<std::size_t>::max() / 2), expected);
+    EXPECT_DEATH((strided_span<int>(arr, 2, 1)), expected);
+    EXPECT_DEATH((strided_span<int>(nullptr, 2, sizeof(int))), expected);
+}